@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <flat_map/columnar_sequence.hpp>
+#include <flat_map/flat_map.hpp>
+#include <flat_map/tied_sequence.hpp>
+#include <random>
+#include <tuple>
+#include <vector>
+
+static std::mt19937_64 rng_state{};
+
+using key_type = std::uint64_t;
+using tied =
+    flat_map::tied_sequence<std::vector<key_type>, std::vector<double>, std::vector<int>>;
+using columns = flat_map::columnar_sequence<key_type, double, int>;
+
+static std::vector<std::tuple<key_type, double, int>> make_rows(std::size_t n) {
+    std::vector<std::tuple<key_type, double, int>> rows(n);
+    for (auto& [k, d, i] : rows) {
+        k = rng_state();
+        d = double(k);
+        i = int(k);
+    }
+    return rows;
+}
+
+template <typename Seq>
+static void BM_push_back(benchmark::State& state) {
+    auto const rows = make_rows(std::size_t(state.range(0)));
+    for (auto _ : state) {
+        Seq seq;
+        for (auto const& row : rows) {
+            seq.push_back(row);
+        }
+        benchmark::DoNotOptimize(seq);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_push_back<tied>)->Range(1 << 4, 1 << 18);
+BENCHMARK(BM_push_back<columns>)->Range(1 << 4, 1 << 18);
+
+template <typename Seq>
+static void BM_insert_middle(benchmark::State& state) {
+    auto const rows = make_rows(std::size_t(state.range(0)));
+    for (auto _ : state) {
+        Seq seq;
+        for (auto const& row : rows) {
+            seq.insert(std::next(seq.begin(), seq.size() / 2), row);
+        }
+        benchmark::DoNotOptimize(seq);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_insert_middle<tied>)->Range(1 << 4, 1 << 14);
+BENCHMARK(BM_insert_middle<columns>)->Range(1 << 4, 1 << 14);
+
+using tied_map    = flat_map::tied_sequence<std::vector<key_type>, std::vector<double>>;
+using columns_map = flat_map::columnar_sequence<key_type, double>;
+
+template <typename Seq>
+static void BM_map_construction(benchmark::State& state) {
+    auto const                                     rows = make_rows(std::size_t(state.range(0)));
+    std::vector<std::pair<key_type const, double>> pairs;
+    for (auto const& [k, d, i] : rows) {
+        pairs.emplace_back(k, d);
+    }
+    for (auto _ : state) {
+        flat_map::flat_map<key_type, double, std::less<key_type>, Seq> fm(
+            pairs.begin(), pairs.end()
+        );
+        benchmark::DoNotOptimize(fm);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_map_construction<tied_map>)->Range(1 << 4, 1 << 18);
+BENCHMARK(BM_map_construction<columns_map>)->Range(1 << 4, 1 << 18);
+
+template <typename Seq>
+static void BM_map_insertion(benchmark::State& state) {
+    auto const rows = make_rows(std::size_t(state.range(0)));
+    for (auto _ : state) {
+        flat_map::flat_map<key_type, double, std::less<key_type>, Seq> fm;
+        for (auto const& [k, d, i] : rows) {
+            fm.try_emplace(k, d);
+        }
+        benchmark::DoNotOptimize(fm);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_map_insertion<tied_map>)->Range(1 << 4, 1 << 14);
+BENCHMARK(BM_map_insertion<columns_map>)->Range(1 << 4, 1 << 14);
+
+BENCHMARK_MAIN();
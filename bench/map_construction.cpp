@@ -31,5 +31,34 @@ BENCHMARK_TEMPLATE(BM_construct_by_iterator, std::unordered_map<int, int>)->Rang
 BENCHMARK_TEMPLATE(BM_construct_by_iterator, flat_map::flat_map<int, int>)->Range(4, 1 << 18);
 BENCHMARK_TEMPLATE(BM_construct_by_iterator, flat_map::flat_map<int, int, std::less<int>, std::deque<std::pair<int, int>>>)
     ->Range(4, 1 << 18);
+// Not std::less, so that keys are sorted by comparison instead of radix sort.
+struct int_less {
+    bool operator()(int lhs, int rhs) const { return lhs < rhs; }
+};
+BENCHMARK_TEMPLATE(BM_construct_by_iterator, flat_map::flat_map<int, int, int_less>)->Range(4, 1 << 18);
+
+template <typename C>
+static void BM_construct_parallel(benchmark::State& state) {
+    std::vector<std::pair<int, int>> v;
+
+    flat_map::parallel_policy const policy{static_cast<unsigned>(state.range(1))};
+    for (auto _ : state) {
+        state.PauseTiming();
+        v.resize(state.range(0));
+        for (auto& [k, v] : v) {
+            k = std::uniform_int_distribution<int>{}(rng_state);
+            v = std::uniform_int_distribution<int>{}(rng_state);
+        }
+        state.ResumeTiming();
+
+        C fm(policy, v.begin(), v.end());
+        benchmark::DoNotOptimize(fm.begin());
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK_TEMPLATE(BM_construct_parallel, flat_map::flat_map<int, int>)
+    ->ArgsProduct({{1 << 16, 1 << 20, 1 << 24}, {1, 2, 4, 8}});
+BENCHMARK_TEMPLATE(BM_construct_parallel, flat_map::flat_map<int, int, std::less<int>, std::deque<std::pair<int, int>>>)
+    ->ArgsProduct({{1 << 16, 1 << 20, 1 << 24}, {1, 2, 4, 8}});
 
 BENCHMARK_MAIN();
@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+#include <flat_map/eytzinger_layout.hpp>
+#include <flat_map/flat_map.hpp>
+#include <flat_map/flat_set.hpp>
+#include <random>
+#include <vector>
+
+static std::mt19937 rng_state{};
+
+inline constexpr std::size_t n_queries = 1 << 12;
+
+template <typename C>
+static C make_container(std::size_t size) {
+    std::vector<typename C::value_type> v(size);
+    for (auto& value : v) {
+        if constexpr (std::is_same_v<typename C::key_type, typename C::value_type>) {
+            value = std::uniform_int_distribution<int>{}(rng_state);
+        } else {
+            value = {std::uniform_int_distribution<int>{}(rng_state), 0};
+        }
+    }
+    return C(v.begin(), v.end());
+}
+
+template <typename C>
+static std::vector<int> make_queries(C const& c) {
+    std::vector<int> q(n_queries);
+    for (auto& k : q) {
+        auto const i = std::uniform_int_distribution<std::size_t>{0, c.size() - 1}(rng_state);
+        if constexpr (std::is_same_v<typename C::key_type, typename C::value_type>) {
+            k = *std::next(c.begin(), i);
+        } else {
+            k = std::next(c.begin(), i)->first;
+        }
+    }
+    return q;
+}
+
+template <typename C>
+static void BM_sorted_find(benchmark::State& state) {
+    auto const c = make_container<C>(state.range(0));
+    auto const q = make_queries(c);
+
+    for (auto _ : state) {
+        for (auto const k : q) {
+            benchmark::DoNotOptimize(c.find(k));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * q.size());
+}
+BENCHMARK_TEMPLATE(BM_sorted_find, flat_map::flat_map<int, int>)->Range(4, 1 << 24);
+BENCHMARK_TEMPLATE(BM_sorted_find, flat_map::flat_set<int>)->Range(4, 1 << 24);
+
+template <typename C>
+static void BM_eytzinger_find(benchmark::State& state) {
+    auto c = make_container<C>(state.range(0));
+    auto q = make_queries(c);
+
+    flat_map::eytzinger_layout<C> const layout{std::move(c)};
+
+    for (auto _ : state) {
+        for (auto const k : q) {
+            benchmark::DoNotOptimize(layout.find(k));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * q.size());
+}
+BENCHMARK_TEMPLATE(BM_eytzinger_find, flat_map::flat_map<int, int>)->Range(4, 1 << 24);
+BENCHMARK_TEMPLATE(BM_eytzinger_find, flat_map::flat_set<int>)->Range(4, 1 << 24);
+
+template <typename C>
+static void BM_eytzinger_freeze(benchmark::State& state) {
+    auto const orig = make_container<C>(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto c = orig;
+        state.ResumeTiming();
+
+        flat_map::eytzinger_layout<C> layout{std::move(c)};
+        benchmark::DoNotOptimize(layout.begin());
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK_TEMPLATE(BM_eytzinger_freeze, flat_map::flat_map<int, int>)->Range(4, 1 << 24);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,78 @@
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <flat_map/flat_map.hpp>
+#include <iterator>
+#include <random>
+#include <vector>
+
+static std::mt19937 rng_state{};
+
+template <typename C>
+static C make_container(std::size_t size) {
+    std::vector<typename C::value_type> v(size);
+    for (auto& value : v) {
+        value = {std::uniform_int_distribution<int>{}(rng_state), 0};
+    }
+    return C(v.begin(), v.end());
+}
+
+template <typename C>
+static std::vector<int> make_queries(C const& c, std::size_t n) {
+    std::vector<int> q(n);
+    for (auto& k : q) {
+        auto const i = std::uniform_int_distribution<std::size_t>{0, c.size() - 1}(rng_state);
+        k            = std::next(c.begin(), i)->first;
+    }
+    return q;
+}
+
+template <typename C>
+static void BM_find_loop(benchmark::State& state) {
+    auto const c = make_container<C>(state.range(0));
+    auto const q = make_queries(c, state.range(1));
+
+    std::vector<typename C::const_iterator> result(q.size());
+    for (auto _ : state) {
+        std::transform(q.begin(), q.end(), result.begin(), [&](int k) { return c.find(k); });
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * q.size());
+}
+BENCHMARK_TEMPLATE(BM_find_loop, flat_map::flat_map<int, int>)
+    ->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 24, 16), {64, 4096}});
+
+template <typename C>
+static void BM_find_many(benchmark::State& state) {
+    auto const c = make_container<C>(state.range(0));
+    auto const q = make_queries(c, state.range(1));
+
+    std::vector<typename C::const_iterator> result(q.size());
+    for (auto _ : state) {
+        c.find_many(q.begin(), q.end(), result.begin());
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * q.size());
+}
+BENCHMARK_TEMPLATE(BM_find_many, flat_map::flat_map<int, int>)
+    ->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 24, 16), {64, 4096}});
+
+template <typename C>
+static void BM_find_many_sorted(benchmark::State& state) {
+    auto const c = make_container<C>(state.range(0));
+    auto       q = make_queries(c, state.range(1));
+    std::sort(q.begin(), q.end());
+
+    std::vector<typename C::const_iterator> result(q.size());
+    for (auto _ : state) {
+        c.find_many(flat_map::range_order::sorted, q.begin(), q.end(), result.begin());
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * q.size());
+}
+BENCHMARK_TEMPLATE(BM_find_many_sorted, flat_map::flat_map<int, int>)
+    ->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 24, 16), {64, 4096}});
+
+BENCHMARK_MAIN();
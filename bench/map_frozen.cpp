@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+#include <flat_map/flat_map.hpp>
+#include <flat_map/frozen_flat_map.hpp>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+static std::mt19937 rng_state{};
+
+inline constexpr std::size_t n_queries = 1 << 12;
+
+using map_type = flat_map::flat_map<std::string, int>;
+
+// Names sharing a long prefix, like HTTP header or metric names, which is the worst case of
+// string comparisons.
+static map_type make_map(std::size_t size) {
+    std::vector<std::pair<std::string, int>> v(size);
+    for (auto& [key, value] : v) {
+        value = std::uniform_int_distribution<int>{}(rng_state);
+        key   = "service.request.latency." + std::to_string(value);
+    }
+    return map_type(v.begin(), v.end());
+}
+
+// Half of the queries hit.
+static std::vector<std::string> make_queries(map_type const& fm) {
+    std::vector<std::string> q(n_queries);
+    for (auto& k : q) {
+        auto const i = std::uniform_int_distribution<std::size_t>{0, fm.size() - 1}(rng_state);
+        k            = std::next(fm.begin(), i)->first;
+        if (rng_state() % 2) {
+            k += '_';
+        }
+    }
+    return q;
+}
+
+template <typename C>
+static void BM_find(benchmark::State& state) {
+    auto       fm = make_map(std::size_t(state.range(0)));
+    auto const q  = make_queries(fm);
+    C const    c(std::move(fm));
+
+    for (auto _ : state) {
+        for (auto const& k : q) {
+            benchmark::DoNotOptimize(c.find(k));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * q.size());
+}
+BENCHMARK_TEMPLATE(BM_find, map_type)->Range(8, 1 << 16);
+BENCHMARK_TEMPLATE(BM_find, flat_map::frozen_flat_map<map_type>)->Range(8, 1 << 16);
+
+static void BM_find_unordered(benchmark::State& state) {
+    auto const fm = make_map(std::size_t(state.range(0)));
+    auto const q  = make_queries(fm);
+
+    std::unordered_map<std::string, int> const um(fm.begin(), fm.end());
+
+    for (auto _ : state) {
+        for (auto const& k : q) {
+            benchmark::DoNotOptimize(um.find(k));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * q.size());
+}
+BENCHMARK(BM_find_unordered)->Range(8, 1 << 16);
+
+static void BM_freeze(benchmark::State& state) {
+    auto const orig = make_map(std::size_t(state.range(0)));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto fm = orig;
+        state.ResumeTiming();
+
+        flat_map::frozen_flat_map frozen{std::move(fm)};
+        benchmark::DoNotOptimize(frozen.begin());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_freeze)->Range(8, 1 << 16);
+
+BENCHMARK_MAIN();
@@ -1,6 +1,9 @@
 #include <benchmark/benchmark.h>
 #include <deque>
+#include <flat_map/buffered_flat_map.hpp>
 #include <flat_map/flat_map.hpp>
+#include <flat_map/flat_multimap.hpp>
+#include <flat_map/tied_sequence.hpp>
 #include <map>
 #include <random>
 #include <unordered_map>
@@ -122,13 +125,13 @@ static void BM_insert_sorted(benchmark::State& state) {
             benchmark::ClobberMemory();
 
             state.ResumeTiming();
-            fm.insert(flat_map::range_order::sorted, v.begin(), v.end());
+            fm.insert(flat_map::range_order::sorted, lv.begin(), lv.end());
             benchmark::ClobberMemory();
             state.PauseTiming();
         }
 
         state.ResumeTiming();
-        orig.insert(flat_map::range_order::sorted, v.begin(), v.end());
+        orig.insert(flat_map::range_order::sorted, lv.begin(), lv.end());
         benchmark::ClobberMemory();
     }
 }
@@ -137,5 +140,40 @@ BENCHMARK(BM_insert_sorted<
               flat_map::flat_map<int, int, std::less<int>, std::deque<std::pair<int, int>>>,
               k_factor>)
     ->Ranges({range, range});
+BENCHMARK(BM_insert_sorted<
+              flat_map::flat_map<
+                  int,
+                  int,
+                  std::less<int>,
+                  flat_map::tied_sequence<std::vector<int>, std::vector<int>>>,
+              k_factor>)
+    ->Ranges({range, range});
+BENCHMARK(BM_insert_sorted<flat_map::flat_multimap<int, int>, k_factor>)->Ranges({range, range});
+
+template <typename C>
+static void BM_single_insertion_stream(benchmark::State& state) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto off   = std::uniform_int_distribution<int>{0, range.second}(rng_state);
+        auto begin = std::next(v.begin(), off);
+        auto end   = std::next(begin, state.range(0));
+        C    c;
+        state.ResumeTiming();
+
+        for (auto itr = begin; itr != end; ++itr) {
+            c.insert(*itr);
+        }
+        benchmark::DoNotOptimize(c.begin());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_single_insertion_stream<std::map<int, int>>)->Range(range.first, range.second);
+BENCHMARK(BM_single_insertion_stream<std::unordered_map<int, int>>)
+    ->Range(range.first, range.second);
+BENCHMARK(BM_single_insertion_stream<flat_map::flat_map<int, int>>)
+    ->Range(range.first, range.second);
+BENCHMARK(BM_single_insertion_stream<flat_map::buffered_flat_map<int, int>>)
+    ->Range(range.first, range.second);
 
 BENCHMARK_MAIN();
@@ -0,0 +1,111 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <flat_map/eytzinger_layout.hpp>
+#include <flat_map/flat_set.hpp>
+#include <flat_map/learned_index.hpp>
+#include <random>
+#include <vector>
+
+static std::mt19937_64 rng_state{};
+
+inline constexpr std::size_t n_queries = 1 << 12;
+
+using set_type = flat_map::flat_set<std::uint64_t>;
+
+static set_type make_uniform(std::size_t size) {
+    std::vector<std::uint64_t> v(size);
+    for (auto& key : v) {
+        key = rng_state();
+    }
+    return set_type(v.begin(), v.end());
+}
+
+// Keys drawn around 64 centers with a small spread, which a single line can't fit.
+static set_type make_clustered(std::size_t size) {
+    std::vector<std::uint64_t> centers(64);
+    for (auto& c : centers) {
+        c = rng_state() >> 1;
+    }
+    std::vector<std::uint64_t> v(size);
+    for (auto& key : v) {
+        auto const c = centers[rng_state() % centers.size()];
+        key          = c + std::uint64_t(std::normal_distribution<double>{0, 1e9}(rng_state));
+    }
+    return set_type(v.begin(), v.end());
+}
+
+static std::vector<std::uint64_t> make_queries(set_type const& fs) {
+    std::vector<std::uint64_t> q(n_queries);
+    for (auto& k : q) {
+        auto const i = std::uniform_int_distribution<std::size_t>{0, fs.size() - 1}(rng_state);
+        k            = *std::next(fs.begin(), i);
+    }
+    return q;
+}
+
+template <set_type (*Make)(std::size_t)>
+static void BM_sorted_find(benchmark::State& state) {
+    auto const fs = Make(std::size_t(state.range(0)));
+    auto const q  = make_queries(fs);
+
+    for (auto _ : state) {
+        for (auto const k : q) {
+            benchmark::DoNotOptimize(fs.find(k));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * q.size());
+}
+BENCHMARK_TEMPLATE(BM_sorted_find, make_uniform)->Range(1 << 10, 1 << 24);
+BENCHMARK_TEMPLATE(BM_sorted_find, make_clustered)->Range(1 << 10, 1 << 24);
+
+template <set_type (*Make)(std::size_t)>
+static void BM_eytzinger_find(benchmark::State& state) {
+    auto       fs = Make(std::size_t(state.range(0)));
+    auto const q  = make_queries(fs);
+
+    flat_map::eytzinger_layout const layout{std::move(fs)};
+
+    for (auto _ : state) {
+        for (auto const k : q) {
+            benchmark::DoNotOptimize(layout.find(k));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * q.size());
+}
+BENCHMARK_TEMPLATE(BM_eytzinger_find, make_uniform)->Range(1 << 10, 1 << 24);
+BENCHMARK_TEMPLATE(BM_eytzinger_find, make_clustered)->Range(1 << 10, 1 << 24);
+
+template <set_type (*Make)(std::size_t)>
+static void BM_learned_find(benchmark::State& state) {
+    auto       fs = Make(std::size_t(state.range(0)));
+    auto const q  = make_queries(fs);
+
+    flat_map::learned_index const index{std::move(fs), std::size_t(state.range(1))};
+
+    for (auto _ : state) {
+        for (auto const k : q) {
+            benchmark::DoNotOptimize(index.find(k));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * q.size());
+    state.counters["segments"] = double(index.segment_count());
+}
+BENCHMARK_TEMPLATE(BM_learned_find, make_uniform)->Ranges({{1 << 10, 1 << 24}, {8, 64}});
+BENCHMARK_TEMPLATE(BM_learned_find, make_clustered)->Ranges({{1 << 10, 1 << 24}, {8, 64}});
+
+static void BM_learned_build(benchmark::State& state) {
+    auto const orig = make_uniform(std::size_t(state.range(0)));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto fs = orig;
+        state.ResumeTiming();
+
+        flat_map::learned_index index{std::move(fs)};
+        benchmark::DoNotOptimize(index.segment_count());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_learned_build)->Range(1 << 10, 1 << 24);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,187 @@
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <deque>
+#include <flat_map/flat_map.hpp>
+#include <flat_map/tied_sequence.hpp>
+#include <map>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+static std::mt19937 rng_state{};
+
+inline constexpr std::size_t n_queries = 1 << 12;
+
+enum distribution : int { uniform, zipf, sequential };
+
+template <typename C, typename = void>
+struct has_contains : std::false_type {};
+
+template <typename C>
+struct has_contains<C, std::void_t<decltype(std::declval<C const&>().contains(0))>>
+    : std::true_type {};
+
+// Keys are even, so that odd keys are never found.
+template <typename C>
+static C make_container(std::size_t size, std::vector<int>& keys) {
+    keys.resize(size);
+    for (auto& k : keys) {
+        k = std::uniform_int_distribution<int>{0, (1 << 30) - 1}(rng_state) * 2;
+    }
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    std::vector<std::pair<int, int>> v;
+    for (auto k : keys) {
+        v.emplace_back(k, 0);
+    }
+    std::shuffle(v.begin(), v.end(), rng_state);
+    return C(v.begin(), v.end());
+}
+
+// Indices into keys following the distribution; ranks of zipf are scattered over the keys.
+static std::vector<std::size_t> make_indices(std::size_t size, distribution dist) {
+    std::vector<std::size_t> indices(n_queries);
+    switch (dist) {
+        case uniform:
+            for (auto& i : indices) {
+                i = std::uniform_int_distribution<std::size_t>{0, size - 1}(rng_state);
+            }
+            break;
+        case zipf: {
+            std::vector<double> cdf(size);
+            double              sum = 0;
+            for (std::size_t r = 0; r < size; ++r) {
+                cdf[r] = sum += 1.0 / static_cast<double>(r + 1);
+            }
+            std::vector<std::size_t> perm(size);
+            std::iota(perm.begin(), perm.end(), 0);
+            std::shuffle(perm.begin(), perm.end(), rng_state);
+            for (auto& i : indices) {
+                auto const u = std::uniform_real_distribution<double>{0, sum}(rng_state);
+                auto const r = std::lower_bound(cdf.begin(), cdf.end(), u) - cdf.begin();
+                i            = perm[std::min(static_cast<std::size_t>(r), size - 1)];
+            }
+            break;
+        }
+        case sequential: {
+            auto start = std::uniform_int_distribution<std::size_t>{0, size - 1}(rng_state);
+            for (auto& i : indices) {
+                i = start++ % size;
+            }
+            break;
+        }
+    }
+    return indices;
+}
+
+// range(0): size, range(1): hit ratio in percent, range(2): distribution.
+static std::vector<int> make_queries(std::vector<int> const& keys, benchmark::State& state) {
+    auto const indices = make_indices(keys.size(), static_cast<distribution>(state.range(2)));
+
+    std::vector<int> q(n_queries);
+    for (std::size_t i = 0; i < n_queries; ++i) {
+        auto const hit = std::uniform_int_distribution<int>{0, 99}(rng_state) < state.range(1);
+        q[i]           = keys[indices[i]] + (hit ? 0 : 1);
+    }
+    return q;
+}
+
+template <typename C, typename F>
+static void run_lookup(benchmark::State& state, F f) {
+    std::vector<int> keys;
+    auto             c = make_container<C>(state.range(0), keys);
+    auto const       q = make_queries(keys, state);
+
+    for (auto _ : state) {
+        for (auto const k : q) {
+            f(c, k);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * q.size());
+}
+
+template <typename C>
+static void BM_find(benchmark::State& state) {
+    run_lookup<C>(state, [](C const& c, int k) { benchmark::DoNotOptimize(c.find(k)); });
+}
+
+template <typename C>
+static void BM_contains(benchmark::State& state) {
+    run_lookup<C>(state, [](C const& c, int k) {
+        if constexpr (has_contains<C>::value) {
+            benchmark::DoNotOptimize(c.contains(k));
+        } else {
+            benchmark::DoNotOptimize(c.count(k) != 0);
+        }
+    });
+}
+
+template <typename C>
+static void BM_count(benchmark::State& state) {
+    run_lookup<C>(state, [](C const& c, int k) { benchmark::DoNotOptimize(c.count(k)); });
+}
+
+template <typename C>
+static void BM_lower_bound(benchmark::State& state) {
+    run_lookup<C>(state, [](C const& c, int k) {
+        if constexpr (std::is_same_v<C, std::unordered_map<int, int>>) {
+            // No ordered lookup; find is the nearest equivalent.
+            benchmark::DoNotOptimize(c.find(k));
+        } else {
+            benchmark::DoNotOptimize(c.lower_bound(k));
+        }
+    });
+}
+
+template <typename C>
+static void BM_equal_range(benchmark::State& state) {
+    run_lookup<C>(state, [](C const& c, int k) { benchmark::DoNotOptimize(c.equal_range(k)); });
+}
+
+template <typename C>
+static void BM_at(benchmark::State& state) {
+    run_lookup<C>(state, [](C const& c, int k) { benchmark::DoNotOptimize(c.at(k)); });
+}
+
+template <typename C>
+static void BM_subscript(benchmark::State& state) {
+    run_lookup<C>(state, [](C& c, int k) { benchmark::DoNotOptimize(c[k]); });
+}
+
+// From L1-resident to DRAM-resident.
+static void lookup_args(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"size", "hit", "dist"});
+    b->ArgsProduct({{1 << 8, 1 << 13, 1 << 17, 1 << 23}, {100, 50, 0}, {uniform, zipf, sequential}}
+    );
+}
+
+// at and operator[] with missing keys throw or insert, so only hits are measured.
+static void hit_args(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"size", "hit", "dist"});
+    b->ArgsProduct({{1 << 8, 1 << 13, 1 << 17, 1 << 23}, {100}, {uniform, zipf, sequential}});
+}
+
+using map_vector = flat_map::flat_map<int, int>;
+using map_deque  = flat_map::flat_map<int, int, std::less<int>, std::deque<std::pair<int, int>>>;
+using map_tied   = flat_map::
+    flat_map<int, int, std::less<int>, flat_map::tied_sequence<std::vector<int>, std::vector<int>>>;
+
+#define LOOKUP_BENCHMARK(fn, args)                                     \
+    BENCHMARK_TEMPLATE(fn, std::map<int, int>)->Apply(args);           \
+    BENCHMARK_TEMPLATE(fn, std::unordered_map<int, int>)->Apply(args); \
+    BENCHMARK_TEMPLATE(fn, map_vector)->Apply(args);                   \
+    BENCHMARK_TEMPLATE(fn, map_deque)->Apply(args);                    \
+    BENCHMARK_TEMPLATE(fn, map_tied)->Apply(args)
+
+LOOKUP_BENCHMARK(BM_find, lookup_args);
+LOOKUP_BENCHMARK(BM_contains, lookup_args);
+LOOKUP_BENCHMARK(BM_count, lookup_args);
+LOOKUP_BENCHMARK(BM_lower_bound, lookup_args);
+LOOKUP_BENCHMARK(BM_equal_range, lookup_args);
+LOOKUP_BENCHMARK(BM_at, hit_args);
+LOOKUP_BENCHMARK(BM_subscript, hit_args);
+
+BENCHMARK_MAIN();
@@ -1,6 +1,8 @@
+#include <array>
 #include <benchmark/benchmark.h>
 #include <deque>
 #include <flat_map/flat_map.hpp>
+#include <flat_map/flat_multimap.hpp>
 #include <map>
 #include <random>
 #include <unordered_map>
@@ -56,5 +58,62 @@ BENCHMARK(BM_merge<
               flat_map::flat_map<int, int, std::less<int>, std::deque<std::pair<int, int>>>,
               k_factor>)
     ->Ranges({range, range});
+BENCHMARK(BM_merge<std::multimap<int, int>, 1>)->Ranges({range, range});
+BENCHMARK(BM_merge<flat_map::flat_multimap<int, int>, k_factor>)->Ranges({range, range});
+
+// Mapped type of 64 bytes, which costs more to move than to compare.
+struct wide {
+    int                 value;
+    std::array<int, 15> padding{};
+
+    wide(int value = 0) : value{value} {}
+};
+
+// Merges state.range(0) shards of state.range(1) elements, pairwise or at once.
+template <typename C, bool all>
+static void BM_merge_shards(benchmark::State& state) {
+    std::vector<C> shards;
+    for (auto i = 0; i < state.range(0); ++i) {
+        std::vector<std::pair<int, int>> elems(state.range(1));
+        for (auto& [k, v] : elems) {
+            k = std::uniform_int_distribution<int>{}(rng_state);
+            v = std::uniform_int_distribution<int>{}(rng_state);
+        }
+        shards.emplace_back(elems.begin(), elems.end());
+    }
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto srcs = shards;
+        C    dst;
+        benchmark::ClobberMemory();
+        state.ResumeTiming();
+
+        if constexpr (all) {
+            dst.merge_all(srcs);
+        } else {
+            for (auto& src : srcs) {
+                dst.merge(src);
+            }
+        }
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_merge_shards<flat_map::flat_map<int, int>, false>)
+    ->Ranges({{2, 256}, {1 << 10, 1 << 14}});
+BENCHMARK(BM_merge_shards<flat_map::flat_map<int, int>, true>)
+    ->Ranges({{2, 256}, {1 << 10, 1 << 14}});
+BENCHMARK(BM_merge_shards<flat_map::flat_multimap<int, int>, false>)
+    ->Ranges({{2, 256}, {1 << 10, 1 << 14}});
+BENCHMARK(BM_merge_shards<flat_map::flat_multimap<int, int>, true>)
+    ->Ranges({{2, 256}, {1 << 10, 1 << 14}});
+BENCHMARK(BM_merge_shards<flat_map::flat_map<int, wide>, false>)
+    ->Ranges({{2, 256}, {1 << 10, 1 << 14}});
+BENCHMARK(BM_merge_shards<flat_map::flat_map<int, wide>, true>)
+    ->Ranges({{2, 256}, {1 << 10, 1 << 14}});
+BENCHMARK(BM_merge_shards<flat_map::flat_multimap<int, wide>, false>)
+    ->Ranges({{2, 256}, {1 << 10, 1 << 14}});
+BENCHMARK(BM_merge_shards<flat_map::flat_multimap<int, wide>, true>)
+    ->Ranges({{2, 256}, {1 << 10, 1 << 14}});
 
 BENCHMARK_MAIN();
@@ -0,0 +1,104 @@
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstdint>
+#include <flat_map/flat_set.hpp>
+#include <flat_map/search_policy.hpp>
+#include <random>
+#include <vector>
+
+static std::mt19937_64 rng_state{};
+
+inline constexpr std::size_t n_queries = 1 << 12;
+
+using key_type = std::uint64_t;
+
+struct interpolation_less : std::less<key_type> {};
+struct exponential_less : std::less<key_type> {};
+
+template <>
+struct flat_map::search_policy<key_type, interpolation_less> {
+    using type = interpolation_search_policy;
+};
+
+template <>
+struct flat_map::search_policy<key_type, exponential_less> {
+    using type = exponential_search_policy;
+};
+
+// Sequential IDs with small gaps.
+static std::vector<key_type> make_uniform(std::size_t size) {
+    std::vector<key_type> v(size);
+    key_type              id = 0;
+    for (auto& key : v) {
+        key = id += 1 + rng_state() % 16;
+    }
+    return v;
+}
+
+// Bursts of timestamps around a few points in time.
+static std::vector<key_type> make_clustered(std::size_t size) {
+    std::vector<key_type> v(size);
+    for (auto& key : v) {
+        auto const burst  = key_type(rng_state() % 16);
+        auto const offset = std::abs(std::normal_distribution<double>{0, 1e6}(rng_state));
+        key               = (burst << 40) + key_type(offset);
+    }
+    return v;
+}
+
+// Keys growing exponentially, where interpolation always lands near the lower end.
+static std::vector<key_type> make_adversarial(std::size_t size) {
+    std::vector<key_type> v(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        v[i] = key_type(std::pow(1.0 + 40.0 / double(size), double(i)) * 1e3) + i;
+    }
+    return v;
+}
+
+template <typename Compare, std::vector<key_type> (*Make)(std::size_t)>
+static void BM_find(benchmark::State& state) {
+    auto const                               v = Make(std::size_t(state.range(0)));
+    flat_map::flat_set<key_type, Compare> const fs(v.begin(), v.end());
+
+    std::vector<key_type> q(n_queries);
+    for (auto& k : q) {
+        k = v[rng_state() % v.size()];
+    }
+
+    for (auto _ : state) {
+        for (auto const k : q) {
+            benchmark::DoNotOptimize(fs.find(k));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * q.size());
+}
+BENCHMARK_TEMPLATE(BM_find, std::less<key_type>, make_uniform)->Range(1 << 10, 1 << 24);
+BENCHMARK_TEMPLATE(BM_find, interpolation_less, make_uniform)->Range(1 << 10, 1 << 24);
+BENCHMARK_TEMPLATE(BM_find, std::less<key_type>, make_clustered)->Range(1 << 10, 1 << 24);
+BENCHMARK_TEMPLATE(BM_find, interpolation_less, make_clustered)->Range(1 << 10, 1 << 24);
+BENCHMARK_TEMPLATE(BM_find, std::less<key_type>, make_adversarial)->Range(1 << 10, 1 << 24);
+BENCHMARK_TEMPLATE(BM_find, interpolation_less, make_adversarial)->Range(1 << 10, 1 << 24);
+
+// Appends slightly out of order IDs with the hint at the end, as a stream of events does.
+template <typename Compare>
+static void BM_insert_near_hint(benchmark::State& state) {
+    auto const size = std::size_t(state.range(0));
+    auto       v    = make_uniform(size);
+    for (std::size_t i = 0; i + 4 < size; i += 4) {
+        std::shuffle(v.begin() + i, v.begin() + i + 8, rng_state);
+    }
+
+    for (auto _ : state) {
+        flat_map::flat_set<key_type, Compare> fs;
+        fs.reserve(size);
+        for (auto const k : v) {
+            fs.insert(fs.end(), k);
+        }
+        benchmark::DoNotOptimize(fs.begin());
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK_TEMPLATE(BM_insert_near_hint, std::less<key_type>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_insert_near_hint, exponential_less)->Range(1 << 10, 1 << 20);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,104 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <flat_map/flat_map.hpp>
+#include <flat_map/search_policy.hpp>
+#include <functional>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+static std::mt19937 rng_state{};
+
+inline constexpr std::size_t n_queries = 1 << 12;
+
+// Not std::less, so that lookups aren't vectorized.
+struct int_less {
+    bool operator()(int lhs, int rhs) const { return lhs < rhs; }
+};
+
+// Same as int_less, but always searched by binary search.
+struct int_less_binary : int_less {};
+
+template <>
+struct flat_map::linear_search_threshold<int, int_less_binary>
+    : public std::integral_constant<std::size_t, 0> {};
+
+// Same as std::less<std::string>, but short ranges are scanned linearly.
+struct string_less_linear : std::less<std::string> {};
+
+template <>
+struct flat_map::linear_search_threshold<std::string, string_less_linear>
+    : public std::integral_constant<std::size_t, 16> {};
+
+template <typename Key>
+static Key make_key(int i) {
+    if constexpr (std::is_same_v<Key, std::string>) {
+        return "x-header-" + std::to_string(i);
+    } else {
+        return i * 2;
+    }
+}
+
+template <typename C>
+static void BM_find(benchmark::State& state) {
+    using key_type = typename C::key_type;
+
+    auto const size = int(state.range(0));
+
+    C                     fm;
+    std::vector<key_type> queries;
+    for (int i = 0; i < size; ++i) {
+        fm.emplace(make_key<key_type>(i), i);
+    }
+    for (std::size_t i = 0; i < n_queries; ++i) {
+        queries.push_back(make_key<key_type>(std::uniform_int_distribution<int>{0, size}(rng_state)));
+    }
+
+    for (auto _ : state) {
+        for (auto const& key : queries) {
+            benchmark::DoNotOptimize(fm.find(key));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * n_queries);
+}
+
+template <typename C>
+static void BM_insert(benchmark::State& state) {
+    using key_type = typename C::key_type;
+
+    auto const            size = int(state.range(0));
+    std::vector<key_type> keys;
+    for (int i = 0; i < size; ++i) {
+        keys.push_back(make_key<key_type>(i));
+    }
+    std::shuffle(keys.begin(), keys.end(), rng_state);
+
+    for (auto _ : state) {
+        C fm;
+        for (auto const& key : keys) {
+            fm.emplace_hint(fm.end(), key, 0);
+        }
+        benchmark::DoNotOptimize(fm);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+static void sizes(benchmark::internal::Benchmark* b) {
+    for (int size : {1, 2, 4, 8, 12, 16, 24, 32, 48, 64}) {
+        b->Arg(size);
+    }
+}
+
+BENCHMARK(BM_find<flat_map::flat_map<int, int, int_less_binary>>)->Apply(sizes);
+BENCHMARK(BM_find<flat_map::flat_map<int, int, int_less>>)->Apply(sizes);
+BENCHMARK(BM_find<flat_map::flat_map<int, int>>)->Apply(sizes);
+BENCHMARK(BM_find<flat_map::flat_map<std::string, int>>)->Apply(sizes);
+BENCHMARK(BM_find<flat_map::flat_map<std::string, int, string_less_linear>>)->Apply(sizes);
+
+BENCHMARK(BM_insert<flat_map::flat_map<int, int, int_less_binary>>)->Apply(sizes);
+BENCHMARK(BM_insert<flat_map::flat_map<int, int, int_less>>)->Apply(sizes);
+BENCHMARK(BM_insert<flat_map::flat_map<std::string, int>>)->Apply(sizes);
+BENCHMARK(BM_insert<flat_map::flat_map<std::string, int, string_less_linear>>)->Apply(sizes);
+
+BENCHMARK_MAIN();
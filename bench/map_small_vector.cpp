@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <flat_map/flat_map.hpp>
+#include <random>
+#include <vector>
+
+static std::mt19937 rng_state{};
+
+inline constexpr std::size_t n_maps = 1 << 10;
+
+using key_type = std::uint32_t;
+
+using vector_map = flat_map::flat_map<key_type, key_type>;
+using small_map  = flat_map::small_flat_map<key_type, key_type, 8>;
+
+static std::vector<std::vector<key_type>> make_keys(std::size_t size) {
+    std::vector<std::vector<key_type>> keys(n_maps);
+    for (auto& k : keys) {
+        for (std::size_t i = 0; i < size; ++i) {
+            k.push_back(rng_state());
+        }
+    }
+    return keys;
+}
+
+// Builds many short-lived small maps, as per-request or per-node maps do.
+template <typename C>
+static void BM_construction(benchmark::State& state) {
+    auto const keys = make_keys(std::size_t(state.range(0)));
+    for (auto _ : state) {
+        for (auto const& k : keys) {
+            C fm;
+            for (auto key : k) {
+                fm.try_emplace(key, key);
+            }
+            benchmark::DoNotOptimize(fm);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * n_maps);
+}
+
+template <typename C>
+static void BM_find(benchmark::State& state) {
+    auto const     keys = make_keys(std::size_t(state.range(0)));
+    std::vector<C> maps;
+    for (auto const& k : keys) {
+        auto& fm = maps.emplace_back();
+        for (auto key : k) {
+            fm.try_emplace(key, key);
+        }
+    }
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < n_maps; ++i) {
+            for (auto key : keys[i]) {
+                benchmark::DoNotOptimize(maps[i].find(key));
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * n_maps * state.range(0));
+}
+
+BENCHMARK(BM_construction<vector_map>)->DenseRange(1, 8);
+BENCHMARK(BM_construction<small_map>)->DenseRange(1, 8);
+BENCHMARK(BM_find<vector_map>)->DenseRange(1, 8);
+BENCHMARK(BM_find<small_map>)->DenseRange(1, 8);
+
+BENCHMARK_MAIN();
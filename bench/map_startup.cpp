@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <filesystem>
+#include <flat_map/flat_map.hpp>
+#include <flat_map/mapped_file.hpp>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+static std::mt19937 rng_state{};
+
+static std::vector<std::pair<int, int>> make_pairs(std::size_t size) {
+    std::vector<std::pair<int, int>> v(size);
+    for (auto& [k, v] : v) {
+        k = std::uniform_int_distribution<int>{}(rng_state);
+        v = std::uniform_int_distribution<int>{}(rng_state);
+    }
+    return v;
+}
+
+static std::string startup_file() {
+    return (std::filesystem::temp_directory_path() / "flat_map_startup.bin").string();
+}
+
+// Rebuilds the table from unsorted elements on every start.
+static void BM_startup_construct(benchmark::State& state) {
+    auto const v = make_pairs(state.range(0));
+
+    for (auto _ : state) {
+        flat_map::flat_map<int, int> fm(v.begin(), v.end());
+        benchmark::DoNotOptimize(fm.find(v.front().first));
+    }
+}
+BENCHMARK(BM_startup_construct)->Range(1 << 10, 1 << 24)->Unit(benchmark::kMicrosecond);
+
+// Reads the saved columns into an owning tied flat_map.
+static void BM_startup_read(benchmark::State& state) {
+    auto const v    = make_pairs(state.range(0));
+    auto const path = startup_file();
+    flat_map::save(flat_map::flat_map<int, int>(v.begin(), v.end()), path);
+
+    using container_type = flat_map::tied_sequence<std::vector<int>, std::vector<int>>;
+    for (auto _ : state) {
+        flat_map::mapped_flat_map<int, int> const mapped{path};
+
+        auto& keys   = mapped.get_container().get_sequence<0>();
+        auto& values = mapped.get_container().get_sequence<1>();
+        flat_map::flat_map<int, int, std::less<int>, container_type> fm{
+            flat_map::range_order::unique_sorted,
+            container_type{
+                           std::vector<int>(keys.begin(), keys.end()),
+                           std::vector<int>(values.begin(), values.end())}
+        };
+        benchmark::DoNotOptimize(fm.find(v.front().first));
+    }
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_startup_read)->Range(1 << 10, 1 << 24)->Unit(benchmark::kMicrosecond);
+
+// Maps the saved file, and looks up once.
+static void BM_startup_mmap(benchmark::State& state) {
+    auto const v    = make_pairs(state.range(0));
+    auto const path = startup_file();
+    flat_map::save(flat_map::flat_map<int, int>(v.begin(), v.end()), path);
+
+    for (auto _ : state) {
+        flat_map::mapped_flat_map<int, int> const mapped{path};
+        benchmark::DoNotOptimize(mapped.find(v.front().first));
+    }
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_startup_mmap)->Range(1 << 10, 1 << 24)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <flat_map/flat_map.hpp>
+#include <random>
+#include <vector>
+
+static std::mt19937 rng_state{};
+
+inline constexpr std::size_t capacity = 256;
+
+using key_type = std::uint32_t;
+
+using vector_map = flat_map::flat_map<key_type, key_type>;
+using static_map = flat_map::static_flat_map<key_type, key_type, capacity>;
+
+static std::vector<key_type> make_keys(std::size_t size) {
+    std::vector<key_type> keys(size);
+    for (auto& key : keys) {
+        key = rng_state();
+    }
+    return keys;
+}
+
+// Fills a map from empty for each iteration, as a per-packet table does.
+template <typename C>
+static void BM_insertion(benchmark::State& state) {
+    auto const keys = make_keys(std::size_t(state.range(0)));
+    for (auto _ : state) {
+        C fm;
+        for (auto key : keys) {
+            fm.try_emplace(key, key);
+        }
+        benchmark::DoNotOptimize(fm);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename C>
+static void BM_find(benchmark::State& state) {
+    auto const keys = make_keys(std::size_t(state.range(0)));
+    C          fm;
+    for (auto key : keys) {
+        fm.try_emplace(key, key);
+    }
+
+    for (auto _ : state) {
+        for (auto key : keys) {
+            benchmark::DoNotOptimize(fm.find(key));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Inserts into a full map, which the static map refuses without throwing.
+template <typename C>
+static void BM_insertion_full(benchmark::State& state) {
+    auto const keys = make_keys(capacity * 2);
+    for (auto _ : state) {
+        C fm;
+        for (auto key : keys) {
+            if constexpr (std::is_same_v<C, static_map>) {
+                fm.try_emplace(key, key);
+            } else if (fm.size() < capacity) {
+                fm.try_emplace(key, key);
+            }
+        }
+        benchmark::DoNotOptimize(fm);
+    }
+    state.SetItemsProcessed(state.iterations() * capacity * 2);
+}
+
+BENCHMARK(BM_insertion<vector_map>)->RangeMultiplier(2)->Range(8, capacity);
+BENCHMARK(BM_insertion<static_map>)->RangeMultiplier(2)->Range(8, capacity);
+BENCHMARK(BM_find<vector_map>)->RangeMultiplier(2)->Range(8, capacity);
+BENCHMARK(BM_find<static_map>)->RangeMultiplier(2)->Range(8, capacity);
+BENCHMARK(BM_insertion_full<vector_map>);
+BENCHMARK(BM_insertion_full<static_map>);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,80 @@
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <flat_map/flat_set.hpp>
+#include <flat_map/set_algorithm.hpp>
+#include <iterator>
+#include <random>
+#include <vector>
+
+static std::mt19937_64 rng_state{};
+
+// state.range(0) elements of the larger one, and state.range(1) is the ratio of sizes.
+static std::pair<flat_map::flat_set<std::uint64_t>, flat_map::flat_set<std::uint64_t>> make_sets(
+    benchmark::State& state
+) {
+    auto const n = static_cast<std::size_t>(state.range(0));
+    auto const m = std::max<std::size_t>(1, n / static_cast<std::size_t>(state.range(1)));
+
+    // Keys are drawn from 2n values so that about half of the smaller one is in the larger one.
+    std::uniform_int_distribution<std::uint64_t> dist{0, 2 * n};
+    std::vector<std::uint64_t>                   a(n), b(m);
+    std::generate(a.begin(), a.end(), [&] { return dist(rng_state); });
+    std::generate(b.begin(), b.end(), [&] { return dist(rng_state); });
+    return {
+        flat_map::flat_set<std::uint64_t>(a.begin(), a.end()),
+        flat_map::flat_set<std::uint64_t>(b.begin(), b.end())};
+}
+
+template <typename Algorithm>
+static void BM_std(benchmark::State& state, Algorithm algorithm) {
+    auto const [a, b] = make_sets(state);
+    for (auto _ : state) {
+        std::vector<std::uint64_t> v;
+        algorithm(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(v));
+        flat_map::flat_set<std::uint64_t> result{
+            flat_map::range_order::unique_sorted, std::move(v)};
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+template <typename Algorithm>
+static void BM_flat(benchmark::State& state, Algorithm algorithm) {
+    auto const [a, b] = make_sets(state);
+    for (auto _ : state) {
+        auto result = algorithm(a, b);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+static void ratios(benchmark::internal::Benchmark* b) {
+    for (auto ratio : {1, 4, 16, 100, 10000}) {
+        b->Args({1 << 20, ratio});
+    }
+}
+
+BENCHMARK_CAPTURE(BM_std, intersection, [](auto... args) {
+    return std::set_intersection(args...);
+})->Apply(ratios);
+BENCHMARK_CAPTURE(BM_flat, intersection, [](auto const& a, auto const& b) {
+    return flat_map::set_intersection(a, b);
+})->Apply(ratios);
+BENCHMARK_CAPTURE(BM_std, union, [](auto... args) { return std::set_union(args...); })
+    ->Apply(ratios);
+BENCHMARK_CAPTURE(BM_flat, union, [](auto const& a, auto const& b) {
+    return flat_map::set_union(a, b);
+})->Apply(ratios);
+BENCHMARK_CAPTURE(BM_std, difference, [](auto... args) {
+    return std::set_difference(args...);
+})->Apply(ratios);
+BENCHMARK_CAPTURE(BM_flat, difference, [](auto const& a, auto const& b) {
+    return flat_map::set_difference(a, b);
+})->Apply(ratios);
+BENCHMARK_CAPTURE(BM_std, symmetric_difference, [](auto... args) {
+    return std::set_symmetric_difference(args...);
+})->Apply(ratios);
+BENCHMARK_CAPTURE(BM_flat, symmetric_difference, [](auto const& a, auto const& b) {
+    return flat_map::set_symmetric_difference(a, b);
+})->Apply(ratios);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,84 @@
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <flat_map/__permutation_sort.hpp>
+#include <flat_map/tied_sequence.hpp>
+#include <functional>
+#include <random>
+#include <utility>
+#include <vector>
+
+static std::mt19937_64 rng_state{};
+
+using key_type = std::uint64_t;
+
+// Not std::less, so that keys are sorted by comparison instead of radix sort.
+struct key_less {
+    bool operator()(key_type lhs, key_type rhs) const { return lhs < rhs; }
+};
+
+template <std::size_t I>
+using column = std::vector<key_type>;
+
+template <typename Indices>
+struct tied_columns;
+
+template <std::size_t... I>
+struct tied_columns<std::index_sequence<I...>> {
+    using type = flat_map::tied_sequence<column<I>...>;
+};
+
+// tied_sequence of N columns of key_type.
+template <std::size_t N>
+using tied = typename tied_columns<std::make_index_sequence<N>>::type;
+
+template <std::size_t N>
+static tied<N> make_rows(std::size_t n) {
+    tied<N> seq(n);
+    for (auto row : seq) {
+        std::get<0>(row) = rng_state();
+    }
+    return seq;
+}
+
+template <std::size_t N, typename Compare>
+static void BM_zip_sort(benchmark::State& state) {
+    auto const rows = make_rows<N>(std::size_t(state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto seq = rows;
+        state.ResumeTiming();
+
+        std::stable_sort(seq.begin(), seq.end(), [](auto const& lhs, auto const& rhs) {
+            return Compare{}(std::get<0>(lhs), std::get<0>(rhs));
+        });
+        benchmark::DoNotOptimize(seq);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <std::size_t N, typename Compare>
+static void BM_permutation_sort(benchmark::State& state) {
+    auto const rows = make_rows<N>(std::size_t(state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto seq = rows;
+        state.ResumeTiming();
+
+        flat_map::detail::permutation_sort<key_type>(seq.begin(), seq.end(), Compare{});
+        benchmark::DoNotOptimize(seq);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_zip_sort<2, key_less>)->Range(1 << 6, 1 << 20);
+BENCHMARK(BM_permutation_sort<2, key_less>)->Range(1 << 6, 1 << 20);
+BENCHMARK(BM_permutation_sort<2, std::less<key_type>>)->Range(1 << 6, 1 << 20);
+BENCHMARK(BM_zip_sort<4, key_less>)->Range(1 << 6, 1 << 20);
+BENCHMARK(BM_permutation_sort<4, key_less>)->Range(1 << 6, 1 << 20);
+BENCHMARK(BM_permutation_sort<4, std::less<key_type>>)->Range(1 << 6, 1 << 20);
+BENCHMARK(BM_zip_sort<8, key_less>)->Range(1 << 6, 1 << 20);
+BENCHMARK(BM_permutation_sort<8, key_less>)->Range(1 << 6, 1 << 20);
+BENCHMARK(BM_permutation_sort<8, std::less<key_type>>)->Range(1 << 6, 1 << 20);
+
+BENCHMARK_MAIN();
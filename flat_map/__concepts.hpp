@@ -38,5 +38,8 @@ using bool_t = bool;
 FLAT_MAP_DEFINE_CONCEPT(Reservable, T, (T c, size_t n), c.reserve(n));
 FLAT_MAP_DEFINE_CONCEPT(HasCapacity, T, (T c), c.capacity());
 FLAT_MAP_DEFINE_CONCEPT(Shrinkable, T, (T c), c.shrink_to_fit());
+FLAT_MAP_DEFINE_CONCEPT(HasData, T, (T c), c.data());
+FLAT_MAP_DEFINE_CONCEPT(Resizable, T, (T c, size_t n), c.resize(n));
+FLAT_MAP_DEFINE_CONCEPT(Bounded, T, (T c), c.full());
 
 }  // namespace flat_map::concepts
@@ -24,6 +24,13 @@
 #    define FLAT_MAP_HAS_THREE_WAY_COMPARISON 1
 #endif
 
+// constexpr for destructors and functions with try block, which are allowed since C++20 (P0784)
+#if defined(__cpp_constexpr_dynamic_alloc)
+#    define FLAT_MAP_CONSTEXPR20 constexpr
+#else
+#    define FLAT_MAP_CONSTEXPR20
+#endif
+
 // C++23 zip support (P2321)
 #ifndef __cpp_lib_ranges_zip
 #    define FLAT_MAP_ZIP_NON_STD_TUPLE
@@ -10,24 +10,121 @@
 #include <iterator>
 #include <memory>
 #include <optional>
+#include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "flat_map/__concepts.hpp"
+#include "flat_map/__permutation_sort.hpp"
+#include "flat_map/__radix_sort.hpp"
+#include "flat_map/__search.hpp"
+#include "flat_map/__type_traits.hpp"
 #include "flat_map/enum.hpp"
+#include "flat_map/execution.hpp"
+#include "flat_map/search_policy.hpp"
 
 namespace flat_map::detail {
 
+// Key part of an element of flat_(multi)map or flat_(multi)set.
+template <typename Key, typename V>
+constexpr decltype(auto) key_of(V const& value) {
+    if constexpr (std::is_convertible_v<V const&, Key const&>) {
+        return value;
+    } else {
+        return std::get<0>(value);
+    }
+}
+
+// Contiguous storage of keys in a container of flat containers if it has one, otherwise nullptr.
+template <typename Key, typename Container>
+constexpr auto key_data_of(Container const& cont) noexcept {
+    if constexpr (std::is_same_v<typename Container::value_type, Key>
+                  && concepts::HasData<Container>) {
+        return cont.data();
+    } else if constexpr (has_columns_v<Container>) {
+        return key_data_of<Key>(cont.template get_sequence<0>());
+    } else {
+        return nullptr;
+    }
+}
+
+// Same as std::stable_sort, but usable in constant evaluation, as it is not constexpr until C++26.
+template <typename RandomAccessIterator, typename Compare>
+constexpr void insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp) {
+    for (auto itr = first; itr != last; ++itr) {
+        std::rotate(std::upper_bound(first, itr, *itr, comp), itr, std::next(itr));
+    }
+}
+
+// Same as std::inplace_merge, but never allocates, by rotating the elements instead of merging
+// them through a buffer. It takes O(N log(N)) time. Usable in constant evaluation since C++20.
+template <typename BidirectionalIterator, typename Compare>
+constexpr void merge_without_buffer(
+    BidirectionalIterator first,
+    BidirectionalIterator middle,
+    BidirectionalIterator last,
+    Compare               comp
+) {
+    auto const len1 = std::distance(first, middle);
+    auto const len2 = std::distance(middle, last);
+    if (len1 == 0 || len2 == 0) {
+        return;
+    }
+    if (len1 + len2 == 2) {
+        if (comp(*middle, *first)) {
+            std::iter_swap(first, middle);
+        }
+        return;
+    }
+    BidirectionalIterator cut1, cut2;
+    if (len1 > len2) {
+        cut1 = std::next(first, len1 / 2);
+        cut2 = std::lower_bound(middle, last, *cut1, comp);
+    } else {
+        cut2 = std::next(middle, len2 / 2);
+        cut1 = std::upper_bound(first, middle, *cut2, comp);
+    }
+    auto const new_middle = std::rotate(cut1, middle, cut2);
+    merge_without_buffer(first, cut1, new_middle, comp);
+    merge_without_buffer(new_middle, cut2, last, comp);
+}
+
+// Same as std::stable_sort, but never allocates, by merging sorted halves by merge_without_buffer.
+// It takes O(N log(N)^2) time. Usable in constant evaluation since C++20.
+template <typename RandomAccessIterator, typename Compare>
+constexpr void stable_sort_without_buffer(
+    RandomAccessIterator first, RandomAccessIterator last, Compare comp
+) {
+    if (std::distance(first, last) <= 16) {
+        insertion_sort(first, last, comp);
+        return;
+    }
+    auto const middle = std::next(first, std::distance(first, last) / 2);
+    stable_sort_without_buffer(first, middle, comp);
+    stable_sort_without_buffer(middle, last, comp);
+    merge_without_buffer(first, middle, last, comp);
+}
+
+// Number of sources from which merge_all merges them by a k-way merge instead of one by one.
+// merge moves each element straight into place as well, but moves the merged ones again for each
+// source, which costs more for larger elements, while a tournament tree costs about the same for
+// any of them. Measured by BM_merge_shards, where multi containers merge one by one faster, as they
+// don't count distinct elements first.
+template <typename T, bool Unique>
+inline constexpr std::size_t k_way_merge_threshold_v =
+    std::max<std::size_t>((Unique ? 256 : 512) / sizeof(T), 2);
+
 template <typename Compare, typename = void>
 struct comparator_store {
     Compare _compare;
 
     comparator_store() = default;
-    comparator_store(Compare const& comp) : _compare{comp} {}
-    comparator_store(Compare&& comp) : _compare{std::move(comp)} {}
+    constexpr comparator_store(Compare const& comp) : _compare{comp} {}
+    constexpr comparator_store(Compare&& comp) : _compare{std::move(comp)} {}
 
-    auto& _comp() const { return _compare; }
-    auto& _comp() { return _compare; }
+    constexpr auto& _comp() const { return _compare; }
+    constexpr auto& _comp() { return _compare; }
 };
 
 template <typename Compare>
@@ -35,11 +132,11 @@ struct comparator_store<
     Compare,
     std::enable_if_t<std::is_class_v<Compare> && !std::is_final_v<Compare>>> : public Compare {
     comparator_store() = default;
-    comparator_store(Compare const& comp) : Compare{comp} {}
-    comparator_store(Compare&& comp) : Compare{std::move(comp)} {}
+    constexpr comparator_store(Compare const& comp) : Compare{comp} {}
+    constexpr comparator_store(Compare&& comp) : Compare{std::move(comp)} {}
 
-    auto& _comp() const { return *static_cast<Compare const*>(this); }
-    auto& _comp() { return *static_cast<Compare*>(this); }
+    constexpr auto& _comp() const { return *static_cast<Compare const*>(this); }
+    constexpr auto& _comp() { return *static_cast<Compare*>(this); }
 };
 
 template <typename Subclass, typename Key, typename Compare, typename Container>
@@ -76,26 +173,396 @@ class _flat_tree_base : private detail::comparator_store<Compare> {
 
     using detail::comparator_store<Compare>::_comp;
 
-    auto _vcomp() const { return static_cast<typename Subclass::_comparator>(key_comp()); }
-    auto _veq() const {
+    constexpr auto _vcomp() const {
+        return static_cast<typename Subclass::_comparator>(key_comp());
+    }
+    constexpr auto _veq() const {
         return [comp = _vcomp()](value_type const& lhs, value_type const& rhs) {
             return !comp(lhs, rhs) && !comp(rhs, lhs);
         };
     }
 
+    // Contiguous storage of keys if the container has one, otherwise nullptr.
+    constexpr auto _key_data() const noexcept { return detail::key_data_of<key_type>(_container); }
+
+    template <typename K>
+    static constexpr bool _is_simd_searchable_v =
+        detail::is_simd_searchable_v<key_type, key_compare, K>
+        && !std::is_null_pointer_v<decltype(std::declval<_flat_tree_base const&>()._key_data())>;
+
+    template <typename Iterator>
+    constexpr auto _offset(Iterator itr) const {
+        return std::distance(cbegin(), const_iterator(itr));
+    }
+
+    // Iterator of the key column which corresponds to itr.
+    template <typename Iterator>
+    constexpr auto _key_column(Iterator itr) const {
+        static_assert(detail::has_columns_v<Container>);
+        return std::next(_container.template get_sequence<0>().begin(), _offset(itr));
+    }
+
+    static constexpr std::size_t _linear_search_threshold =
+        detail::linear_search_threshold_v<Key, Compare>;
+
+    using _search_policy = detail::search_policy_t<Key, Compare>;
+
+    static constexpr bool _is_interpolation_v =
+        std::is_same_v<_search_policy, interpolation_search_policy>;
+    static_assert(
+        !_is_interpolation_v
+            || (std::is_arithmetic_v<key_type> && !std::is_same_v<key_type, bool>
+                && (std::is_base_of_v<std::less<key_type>, Compare>
+                    || std::is_base_of_v<std::less<>, Compare>)),
+        "interpolation_search_policy requires arithmetic keys ordered by std::less"
+    );
+
+    template <typename K>
+    static constexpr bool _is_interpolation_searchable_v =
+        _is_interpolation_v && std::is_same_v<K, key_type>;
+
+    // Whether insertions with a hint search exponentially from the hint.
+    static constexpr bool _is_exponential_v =
+        !std::is_same_v<_search_policy, binary_search_policy>;
+
+    // Offset of lower bound (Strict == true) or upper bound (Strict == false) of key in
+    // [first, first + len), which is scanned linearly if the range is short.
+    template <bool Strict, typename RandomAccessIterator, typename K, typename Comp>
+    constexpr static std::size_t _bound_offset(
+        RandomAccessIterator first, std::size_t len, K const& key, Comp const& comp
+    ) {
+        if (len < _linear_search_threshold) {
+            return detail::linear_bound<Strict>(first, len, key, comp);
+        }
+        auto const last = std::next(first, len);
+        if constexpr (Strict) {
+            return std::size_t(std::distance(first, std::lower_bound(first, last, key, comp)));
+        } else {
+            return std::size_t(std::distance(first, std::upper_bound(first, last, key, comp)));
+        }
+    }
+
+    // Same as std::lower_bound or std::upper_bound, but uses vectorized search if possible, only
+    // walks the key column of columnar containers, and scans short ranges linearly.
+    template <bool Strict, typename Iterator, typename K>
+    constexpr Iterator _bisect(Iterator first, Iterator last, K const& key) const {
+        auto const len = std::size_t(std::distance(first, last));
+        if constexpr (_is_simd_searchable_v<K>) {
+            if (!detail::is_constant_evaluated()) {
+                auto const keys = _key_data() + _offset(first);
+                if (len < _linear_search_threshold) {
+                    return std::next(first, detail::simd_count_preceding<Strict>(keys, len, key));
+                }
+                return std::next(first, detail::simd_bound<Strict>(keys, len, key));
+            }
+        } else if constexpr (detail::has_columns_v<Container>) {
+            auto const keys = _key_column(first);
+            return std::next(first, _bound_offset<Strict>(keys, len, key, this->_comp()));
+        }
+        return std::next(first, _bound_offset<Strict>(first, len, key, _vcomp()));
+    }
+
+    // Same as _bisect, but narrows the range by interpolation search beforehand if the policy is
+    // interpolation_search_policy.
+    template <bool Strict, typename Iterator, typename K>
+    constexpr Iterator _bound(Iterator first, Iterator last, K const& key) const {
+        if constexpr (_is_interpolation_searchable_v<K>) {
+            auto const len   = std::size_t(std::distance(first, last));
+            auto const range = [&] {
+                auto const identity = [](key_type k) { return k; };
+                if constexpr (!std::is_null_pointer_v<decltype(_key_data())>) {
+                    auto const keys = _key_data() + _offset(first);
+                    return detail::interpolation_narrow<Strict>(keys, len, key, identity);
+                } else if constexpr (detail::has_columns_v<Container>) {
+                    auto const keys = _key_column(first);
+                    return detail::interpolation_narrow<Strict>(keys, len, key, identity);
+                } else {
+                    auto const proj = [](value_type const& v) {
+                        return Subclass::_key_extractor(v);
+                    };
+                    return detail::interpolation_narrow<Strict>(first, len, key, proj);
+                }
+            }();
+            first = std::next(first, range.first);
+            last  = std::next(first, range.second - range.first);
+        }
+        return _bisect<Strict>(first, last, key);
+    }
+
+    // Same as std::lower_bound(first, last, key, _vcomp()), but faster.
+    template <typename Iterator, typename K>
+    constexpr Iterator _lower_bound(Iterator first, Iterator last, K const& key) const {
+        return _bound<true>(first, last, key);
+    }
+
+    // Same as std::upper_bound(first, last, key, _vcomp()), but faster.
+    template <typename Iterator, typename K>
+    constexpr Iterator _upper_bound(Iterator first, Iterator last, K const& key) const {
+        return _bound<false>(first, last, key);
+    }
+
+    // Same as _bound<Strict>(first, last, key), but probes 1, 2, 4, ... elements away from first
+    // (Backward == false) or last (Backward == true) before searching between the last two probes
+    // if the policy is exponential, as the result of a hinted insertion is likely near the hint.
+    template <bool Strict, bool Backward>
+    const_iterator _bound_near(
+        const_iterator first, const_iterator last, key_type const& key
+    ) const {
+        if constexpr (!_is_exponential_v) {
+            return _bound<Strict>(first, last, key);
+        } else {
+            auto const comp     = _vcomp();
+            auto const precedes = [&](std::size_t i) {
+                auto const& value = *std::next(first, i);
+                return Strict ? comp(value, key) : !comp(key, value);
+            };
+            auto const  len  = std::size_t(std::distance(first, last));
+            std::size_t lo   = 0;
+            std::size_t hi   = len;
+            std::size_t step = 1;
+            if constexpr (Backward) {
+                for (; step <= len && !precedes(len - step); step *= 2) {
+                    hi = len - step;
+                }
+                lo = step > len ? 0 : len - step + 1;
+            } else {
+                for (; step <= len && precedes(step - 1); step *= 2) {
+                    lo = step;
+                }
+                hi = step > len ? len : step - 1;
+            }
+            return _bound<Strict>(std::next(first, lo), std::next(first, hi), key);
+        }
+    }
+
+    static constexpr difference_type _radix_sort_threshold = detail::radix_sort_threshold;
+
+    // Whether rows are sorted by a permutation of the key column rather than moved as tuples.
+    static constexpr bool _is_permutation_sortable_v =
+        detail::has_columns_v<Container> && !std::is_same_v<value_type, key_type>;
+
+    // Same as std::stable_sort(first, last, _vcomp()), but sorts a permutation of keys for columnar
+    // containers and uses radix sort for arithmetic keys ordered by std::less or std::greater.
+    // Bounded containers are sorted without a buffer, as they are used where the heap isn't.
+    constexpr void _stable_sort(iterator first, iterator last) {
+        if (detail::is_constant_evaluated()) {
+            detail::insertion_sort(first, last, _vcomp());
+            return;
+        }
+        if constexpr (concepts::Bounded<Container>) {
+            detail::stable_sort_without_buffer(first, last, _vcomp());
+            return;
+        } else if constexpr (_is_permutation_sortable_v) {
+            detail::permutation_sort<Key>(first, last, this->_comp());
+            return;
+        } else if constexpr (
+            detail::is_radix_sortable_v<Key, Compare>
+            && std::is_default_constructible_v<value_type>
+        ) {
+            if (std::distance(first, last) >= _radix_sort_threshold) {
+                detail::radix_sort<Key, Compare>(first, last, [](auto const& value) {
+                    return Subclass::_key_extractor(value);
+                });
+                return;
+            }
+        }
+        std::stable_sort(first, last, _vcomp());
+    }
+
+    // Elements are moved within the container by assignment, which must not throw to close the gap
+    // if merging is interrupted by an exception.
+    template <typename Iterator>
+    static constexpr bool _is_back_mergeable_v =
+        concepts::Resizable<Container> && std::is_default_constructible_v<value_type>
+        && std::is_nothrow_move_assignable_v<value_type>
+        && std::is_base_of_v<
+            std::bidirectional_iterator_tag,
+            typename std::iterator_traits<Iterator>::iterator_category>
+        && std::is_constructible_v<value_type, typename std::iterator_traits<Iterator>::reference>;
+
+    // Merges sorted [first, last) into the container without a temporary buffer, by growing the
+    // container once and merging backward from the tail. Elements are compared by their keys, so
+    // that elements of a source with another value_type aren't converted.
+    // For unique containers, elements equivalent to an existing one or the preceding one in
+    // [first, last) are dropped in the same pass, and the gap left by them is closed at last.
+    // Bounded containers grow only by the elements to be merged instead, so that they don't
+    // overflow unless the result does.
+    template <typename BidirectionalIterator>
+    void _merge_back(BidirectionalIterator first, BidirectionalIterator last) {
+        auto const len = _container.size();
+        auto       n   = static_cast<size_type>(std::distance(first, last));
+        if constexpr (
+            concepts::Bounded<Container> && Subclass::_order == range_order::unique_sorted
+        ) {
+            n = _count_distinct(first, last);
+        }
+        _container.resize(len + n);
+        _merge_backward(len, _container.size(), first, last);
+    }
+
+    // Number of elements of sorted [first, last) which are equivalent to neither an existing one
+    // nor the preceding one in [first, last), that is, which a unique container would merge.
+    template <typename ForwardIterator>
+    size_type _count_distinct(ForwardIterator first, ForwardIterator last) const {
+        auto const& comp   = this->_comp();
+        size_type   count  = 0;
+        auto        target = _container.begin();
+        auto        prev   = last;
+        for (auto itr = first; itr != last; prev = itr++) {
+            auto const& key = Subclass::_key_extractor(*itr);
+            while (target != _container.end() && comp(Subclass::_key_extractor(*target), key)) {
+                ++target;
+            }
+            count += (target == _container.end() || comp(key, Subclass::_key_extractor(*target)))
+                     && (prev == last || comp(Subclass::_key_extractor(*prev), key));
+        }
+        return count;
+    }
+
+    // Merges sorted [first, last) and [0, len) of the container into [0, stop) backward, where
+    // [len, stop) holds no element, and then erases the gap and [stop, end()). Once [len, stop) is
+    // filled, the rest of [first, last) is equivalent to merged ones and dropped.
+    // If an exception is thrown, the gap is closed as well. Every element of [0, len) is still
+    // there and the container is still sorted, as the merged ones aren't less than the rest.
+    template <typename BidirectionalIterator>
+    void _merge_backward(
+        size_type len, size_type stop, BidirectionalIterator first, BidirectionalIterator last
+    ) {
+        auto const& comp  = this->_comp();
+        auto        mid   = std::next(_container.begin(), len);
+        auto const  bound = std::next(_container.begin(), stop);
+        auto        out   = bound;
+        auto const  close_gap = [&] {
+            auto const tail = out != mid ? std::move(out, bound, mid) : bound;
+            _container.erase(tail, _container.end());
+        };
+
+        try {
+            while (first != last && out != mid) {
+                auto const  prev = std::prev(last);
+                auto const& key  = Subclass::_key_extractor(*prev);
+                if (mid != _container.begin()
+                    && comp(key, Subclass::_key_extractor(*std::prev(mid)))) {
+                    *--out = std::move(*--mid);
+                    continue;
+                }
+                if constexpr (Subclass::_order == range_order::unique_sorted) {
+                    if ((mid != _container.begin()
+                         && !comp(Subclass::_key_extractor(*std::prev(mid)), key))
+                        || (prev != first
+                            && !comp(Subclass::_key_extractor(*std::prev(prev)), key))) {
+                        last = prev;
+                        continue;
+                    }
+                }
+                if constexpr (std::is_same_v<std::decay_t<decltype(*prev)>, value_type>) {
+                    *std::prev(out) = *prev;
+                } else {
+                    *std::prev(out) = value_type(*prev);
+                }
+                --out;
+                last = prev;
+            }
+        } catch (...) {
+            close_gap();
+            throw;
+        }
+        close_gap();
+    }
+
+    // Same as std::inplace_merge(begin(), mid, end()), but without a temporary buffer if possible,
+    // by growing the container by the length of [mid, end()), moving them to the new tail and
+    // merging backward into the space which they have left. Otherwise, bounded containers merge
+    // by rotation, so that they never allocate.
+    // For unique containers, elements of [mid, end()) equivalent to a preceding one are dropped.
+    constexpr void _merge_tail(iterator mid) {
+        if (mid == _container.begin()) {
+            if constexpr (Subclass::_order == range_order::unique_sorted) {
+                _container.erase(std::unique(mid, _container.end(), _veq()), _container.end());
+            }
+            return;
+        }
+        if (mid == _container.end()) {
+            return;
+        }
+        if constexpr (_is_back_mergeable_v<std::move_iterator<iterator>>) {
+            auto const len = static_cast<size_type>(std::distance(_container.begin(), mid));
+            auto const n   = _container.size() - len;
+            if (!detail::is_constant_evaluated() && len + 2 * n <= _container.max_size()) {
+                _container.resize(len + 2 * n);
+                auto const run = std::next(_container.begin(), len + n);
+                std::move(std::next(_container.begin(), len), run, run);
+                _merge_backward(
+                    len,
+                    len + n,
+                    std::make_move_iterator(run),
+                    std::make_move_iterator(_container.end())
+                );
+                return;
+            }
+        }
+        if constexpr (concepts::Bounded<Container>) {
+            detail::merge_without_buffer(_container.begin(), mid, _container.end(), _vcomp());
+        } else {
+            std::inplace_merge(_container.begin(), mid, _container.end(), _vcomp());
+        }
+        if constexpr (Subclass::_order == range_order::unique_sorted) {
+            _container.erase(
+                std::unique(_container.begin(), _container.end(), _veq()), _container.end()
+            );
+        }
+    }
+
+    // Same as insert(order, first, last), but never grows a bounded container beyond the result.
+    // Elements are appended as many as it has room for and merged, which drops duplicates and
+    // makes room for the rest. Only an element which doesn't fit even then overflows.
     template <typename InputIterator>
-    void _initialize_container(InputIterator first, InputIterator last) {
+    constexpr void _insert_bounded(range_order order, InputIterator first, InputIterator last) {
+        while (first != last) {
+            auto const len = _container.size();
+            for (; first != last && !_container.full(); ++first) {
+                _container.emplace(_container.end(), *first);
+            }
+            auto const mid = std::next(_container.begin(), len);
+            if (order == range_order::no_ordered || order == range_order::uniqued) {
+                _stable_sort(mid, _container.end());
+            }
+            _merge_tail(mid);
+
+            if (first != last && _container.full()) {
+                value_type value(*first);
+                if constexpr (Subclass::_order == range_order::unique_sorted) {
+                    if (std::binary_search(
+                            _container.begin(), _container.end(), value, _vcomp()
+                        )) {
+                        ++first;
+                        continue;
+                    }
+                }
+                // Throws std::length_error, as the container is full.
+                _container.emplace(_container.end(), std::move(value));
+            }
+        }
+    }
+
+    template <typename InputIterator>
+    constexpr void _initialize_container(InputIterator first, InputIterator last) {
+        if constexpr (concepts::Bounded<Container>) {
+            _container.clear();
+            _insert_bounded(range_order::no_ordered, first, last);
+            return;
+        }
         _container.assign(first, last);
-        std::stable_sort(_container.begin(), _container.end(), _vcomp());
+        _stable_sort(_container.begin(), _container.end());
         if constexpr (Subclass::_order == range_order::unique_sorted) {
             auto itr = std::unique(_container.begin(), _container.end(), _veq());
             _container.erase(itr, _container.end());
         }
     }
 
-    void _sort_container(range_order order) {
+    constexpr void _sort_container(range_order order) {
         if (order == range_order::no_ordered || order == range_order::uniqued) {
-            std::stable_sort(_container.begin(), _container.end(), _vcomp());
+            _stable_sort(_container.begin(), _container.end());
         }
         if constexpr (Subclass::_order == range_order::unique_sorted) {
             if (order == range_order::no_ordered || order == range_order::sorted) {
@@ -105,66 +572,133 @@ class _flat_tree_base : private detail::comparator_store<Compare> {
         }
     }
 
+    template <typename InputIterator>
+    void _initialize_container(
+        parallel_policy const& policy, InputIterator first, InputIterator last
+    ) {
+        _container.assign(first, last);
+        _sort_container(policy, range_order::no_ordered);
+    }
+
+    void _sort_container(parallel_policy const& policy, range_order order) {
+        if (order == range_order::no_ordered || order == range_order::uniqued) {
+            detail::parallel_stable_sort(policy, _container.begin(), _container.end(), _vcomp());
+        }
+        if constexpr (Subclass::_order == range_order::unique_sorted) {
+            if (order == range_order::no_ordered || order == range_order::sorted) {
+                auto itr =
+                    detail::parallel_unique(policy, _container.begin(), _container.end(), _veq());
+                _container.erase(itr, _container.end());
+            }
+        }
+    }
+
    public:
     _flat_tree_base() = default;
 
-    explicit _flat_tree_base(Compare const& comp, allocator_type const& alloc)
+    constexpr explicit _flat_tree_base(Compare const& comp, allocator_type const& alloc)
         : detail::comparator_store<Compare>{comp}, _container{alloc} {}
 
-    explicit _flat_tree_base(allocator_type const& alloc) : _container{alloc} {}
+    constexpr explicit _flat_tree_base(allocator_type const& alloc) : _container{alloc} {}
 
     _flat_tree_base(_flat_tree_base const& other) = default;
-    _flat_tree_base(_flat_tree_base const& other, allocator_type const& alloc)
+    constexpr _flat_tree_base(_flat_tree_base const& other, allocator_type const& alloc)
         : detail::comparator_store<Compare>{other._comp()}, _container{other._container, alloc} {}
 
     _flat_tree_base(_flat_tree_base&& other) = default;
-    _flat_tree_base(_flat_tree_base&& other, allocator_type const& alloc)
+    constexpr _flat_tree_base(_flat_tree_base&& other, allocator_type const& alloc)
         : detail::comparator_store<Compare>{std::move(other._comp())},
           _container{std::move(other._container), alloc} {}
 
-    explicit _flat_tree_base(range_order order, Container cont) : _container{std::move(cont)} {
+    constexpr explicit _flat_tree_base(range_order order, Container cont)
+        : _container{std::move(cont)} {
         _sort_container(order);
     }
 
-    explicit _flat_tree_base(range_order order, Container cont, Compare const& comp)
+    constexpr explicit _flat_tree_base(range_order order, Container cont, Compare const& comp)
         : detail::comparator_store<Compare>{comp}, _container{std::move(cont)} {
         _sort_container(order);
     }
 
+    explicit _flat_tree_base(
+        parallel_policy const& policy, range_order order, Container cont, Compare const& comp
+    )
+        : detail::comparator_store<Compare>{comp}, _container{std::move(cont)} {
+        _sort_container(policy, order);
+    }
+
+    // Trusts that cont is already ordered as Order, for containers which can't be reordered.
+    template <range_order Order>
+    constexpr explicit _flat_tree_base(range_order_t<Order>, Container cont, Compare const& comp)
+        : detail::comparator_store<Compare>{comp}, _container{std::move(cont)} {}
+
     _flat_tree_base& operator=(_flat_tree_base const& other) = default;
 
     _flat_tree_base& operator=(_flat_tree_base&& other
     ) noexcept(noexcept(_container = std::move(other._container)) && std::is_nothrow_move_assignable_v<Compare>) =
         default;
 
-    allocator_type get_allocator() const noexcept { return _container.get_allocator(); }
-
-    iterator               begin() noexcept { return _container.begin(); }
-    const_iterator         begin() const noexcept { return _container.begin(); }
-    const_iterator         cbegin() const noexcept { return _container.cbegin(); }
-    iterator               end() noexcept { return _container.end(); }
-    const_iterator         end() const noexcept { return _container.end(); }
-    const_iterator         cend() const noexcept { return _container.cend(); }
-    reverse_iterator       rbegin() noexcept { return _container.rbegin(); }
-    const_reverse_iterator rbegin() const noexcept { return _container.rbegin(); }
-    const_reverse_iterator crbegin() const noexcept { return _container.crbegin(); }
-    reverse_iterator       rend() noexcept { return _container.rend(); }
-    const_reverse_iterator rend() const noexcept { return _container.rend(); }
-    const_reverse_iterator crend() const noexcept { return _container.crend(); }
-
-    [[nodiscard]] bool empty() const noexcept { return _container.empty(); }
-    size_type          size() const noexcept { return _container.size(); }
-    size_type          max_size() const noexcept { return _container.max_size(); }
+    constexpr allocator_type get_allocator() const noexcept { return _container.get_allocator(); }
+
+    constexpr iterator               begin() noexcept { return _container.begin(); }
+    constexpr const_iterator         begin() const noexcept { return _container.begin(); }
+    constexpr const_iterator         cbegin() const noexcept { return _container.cbegin(); }
+    constexpr iterator               end() noexcept { return _container.end(); }
+    constexpr const_iterator         end() const noexcept { return _container.end(); }
+    constexpr const_iterator         cend() const noexcept { return _container.cend(); }
+    constexpr reverse_iterator       rbegin() noexcept { return _container.rbegin(); }
+    constexpr const_reverse_iterator rbegin() const noexcept { return _container.rbegin(); }
+    constexpr const_reverse_iterator crbegin() const noexcept { return _container.crbegin(); }
+    constexpr reverse_iterator       rend() noexcept { return _container.rend(); }
+    constexpr const_reverse_iterator rend() const noexcept { return _container.rend(); }
+    constexpr const_reverse_iterator crend() const noexcept { return _container.crend(); }
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return _container.empty(); }
+    constexpr size_type          size() const noexcept { return _container.size(); }
+    constexpr size_type          max_size() const noexcept { return _container.max_size(); }
     void clear() noexcept { return _container.clear(); }
 
+    // extension
+    template <typename C = Container>
+    std::enable_if_t<concepts::Reservable<C>> reserve(size_type new_cap) {
+        _container.reserve(new_cap);
+    }
+
+    // extension
+    template <typename C = Container>
+    constexpr std::enable_if_t<concepts::HasCapacity<C>, size_type> capacity() const noexcept {
+        return _container.capacity();
+    }
+
+    // extension
+    template <typename C = Container>
+    std::enable_if_t<concepts::Shrinkable<C>> shrink_to_fit() {
+        _container.shrink_to_fit();
+    }
+
+    // extension
+    template <typename C = Container>
+    constexpr std::enable_if_t<concepts::Bounded<C>, bool> full() const noexcept {
+        return _container.full();
+    }
+
+    // Whether a single element insertion should be refused instead of growing the container.
+    constexpr bool _is_full() const noexcept {
+        if constexpr (concepts::Bounded<Container>) {
+            return _container.full();
+        } else {
+            return false;
+        }
+    }
+
     template <typename K>
-    std::pair<iterator, bool> _find(K const& key) {
+    constexpr std::pair<iterator, bool> _find(K const& key) {
         auto itr = lower_bound(key);
         return {itr, !(itr == end() || _vcomp()(key, *itr))};
     }
 
     template <typename K>
-    std::pair<const_iterator, bool> _find(K const& key) const {
+    constexpr std::pair<const_iterator, bool> _find(K const& key) const {
         return const_cast<_flat_tree_base*>(this)->_find(key);
     }
 
@@ -174,10 +708,16 @@ class _flat_tree_base : private detail::comparator_store<Compare> {
             // It should be guaranteed that the value isn't changed when found
             auto [itr, found] = _find(Subclass::_key_extractor(value));
             if (!found) {
+                if (_is_full()) {
+                    return std::make_pair(end(), false);
+                }
                 itr = _container.insert(itr, std::forward<V>(value));
             }
             return std::make_pair(itr, !found);
         } else {
+            if (_is_full()) {
+                return end();
+            }
             auto itr = upper_bound(Subclass::_key_extractor(value));
             return _container.insert(itr, std::forward<V>(value));
         }
@@ -204,7 +744,7 @@ class _flat_tree_base : private detail::comparator_store<Compare> {
             if (_vcomp()(key, *hint)) {
                 bool insert_here = hint == begin() || _vcomp()(*std::prev(hint), key);  // 1
                 if (!insert_here) {
-                    hint = std::lower_bound(cbegin(), std::prev(hint), key, _vcomp());
+                    hint = _bound_near<true, true>(cbegin(), std::prev(hint), key);
                     bool found_insert_point = _vcomp()(key, *hint);  // 2
                     if (!found_insert_point) {
                         return std::make_pair(_mutable(hint), true);
@@ -216,7 +756,7 @@ class _flat_tree_base : private detail::comparator_store<Compare> {
                     return std::make_pair(_mutable(hint), true);
                 }  // 4
 
-                hint                    = std::lower_bound(std::next(hint), cend(), key, _vcomp());
+                hint                    = _bound_near<true, false>(std::next(hint), cend(), key);
                 bool found_insert_point = hint == end() || _vcomp()(key, *hint);  // 5
                 if (!found_insert_point) {
                     return std::make_pair(_mutable(hint), true);
@@ -235,10 +775,10 @@ class _flat_tree_base : private detail::comparator_store<Compare> {
         if (hint == end() || !_vcomp()(*hint, key)) {
             bool insert_here = hint == begin() || !_vcomp()(key, *std::prev(hint));  // 1
             if (!insert_here) {
-                hint = std::upper_bound(cbegin(), std::prev(hint), key, _vcomp());  // 2
+                hint = _bound_near<false, true>(cbegin(), std::prev(hint), key);  // 2
             }
         } else {
-            hint = std::lower_bound(std::next(hint), cend(), key, _vcomp());  // 3
+            hint = _bound_near<true, false>(std::next(hint), cend(), key);  // 3
         }
         return hint;
     }
@@ -248,10 +788,16 @@ class _flat_tree_base : private detail::comparator_store<Compare> {
         if constexpr (Subclass::_order == range_order::unique_sorted) {
             auto [itr, found] = _insert_point_uniq(hint, Subclass::_key_extractor(value));
             if (!found) {
+                if (_is_full()) {
+                    return end();
+                }
                 itr = _container.insert(itr, std::forward<V>(value));
             }
             return itr;
         } else {
+            if (_is_full()) {
+                return end();
+            }
             auto itr = _insert_point_multi(hint, Subclass::_key_extractor(value));
             return _container.insert(itr, std::forward<V>(value));
         }
@@ -280,22 +826,24 @@ class _flat_tree_base : private detail::comparator_store<Compare> {
     // extension
     template <typename InputIterator>
     void insert(range_order order, InputIterator first, InputIterator last) {
-        auto mid = _container.insert(_container.end(), first, last);
-        switch (order) {
-            case range_order::no_ordered:
-            case range_order::uniqued:
-                std::stable_sort(_container.begin(), _container.end(), _vcomp());
-                break;
+        if constexpr (_is_back_mergeable_v<InputIterator>) {
+            if (order == range_order::sorted || order == range_order::unique_sorted) {
+                _merge_back(first, last);
+                return;
+            }
+        }
 
-            case range_order::sorted:
-            case range_order::unique_sorted:
-                std::inplace_merge(_container.begin(), mid, _container.end(), _vcomp());
-                break;
+        if constexpr (concepts::Bounded<Container>) {
+            _insert_bounded(order, first, last);
+            return;
         }
-        if constexpr (Subclass::_order == range_order::unique_sorted) {
-            auto itr = std::unique(_container.begin(), _container.end(), _veq());
-            _container.erase(itr, _container.end());
+
+        // Others are appended and sorted, and then merged as a sorted range.
+        auto mid = _container.insert(_container.end(), first, last);
+        if (order == range_order::no_ordered || order == range_order::uniqued) {
+            _stable_sort(mid, _container.end());
         }
+        _merge_tail(mid);
     }
 
     // extension
@@ -303,6 +851,23 @@ class _flat_tree_base : private detail::comparator_store<Compare> {
         insert(order, ilist.begin(), ilist.end());
     }
 
+    // extension
+    template <typename InputIterator>
+    void insert(
+        parallel_policy const& policy, range_order order, InputIterator first, InputIterator last
+    ) {
+        auto const mid = _container.insert(_container.end(), first, last);
+        if (order == range_order::no_ordered || order == range_order::uniqued) {
+            detail::parallel_stable_sort(policy, mid, _container.end(), _vcomp());
+        }
+        std::inplace_merge(_container.begin(), mid, _container.end(), _vcomp());
+        if constexpr (Subclass::_order == range_order::unique_sorted) {
+            auto itr =
+                detail::parallel_unique(policy, _container.begin(), _container.end(), _veq());
+            _container.erase(itr, _container.end());
+        }
+    }
+
     auto insert(node_type&& node) {
         if constexpr (Subclass::_order == range_order::unique_sorted) {
             if (!node.value.has_value()) {
@@ -362,7 +927,7 @@ class _flat_tree_base : private detail::comparator_store<Compare> {
 
     void replace(Container&& cont) { _container = std::move(cont); }
 
-    const Container& get_container() const { return _container; }
+    constexpr const Container& get_container() const { return _container; }
 
     // FIXME: Stateful comparator is always treated as non equivalent comparator.
     template <typename Cont>
@@ -376,10 +941,9 @@ class _flat_tree_base : private detail::comparator_store<Compare> {
         auto const len   = _container.size();
         auto       first = _container.begin();
         for (auto itr = source.begin(); itr != source.end();) {
-            auto const&                 key  = Subclass::_key_extractor(*itr);
-            auto const                  mid  = std::next(_container.begin(), len);
-            auto                        lb   = std::lower_bound(first, mid, key, _vcomp());
-            [[maybe_unused]] auto const dist = std::distance(_container.begin(), lb);
+            auto const& key = Subclass::_key_extractor(*itr);
+            auto const  mid = std::next(_container.begin(), len);
+            auto        lb  = _lower_bound(first, mid, key);
             if (lb == mid || _vcomp()(key, *lb)) {
                 typename std::iterator_traits<typename Cont::iterator>::value_type tmp =
                     std::move(*itr);
@@ -393,29 +957,182 @@ class _flat_tree_base : private detail::comparator_store<Compare> {
             } else {
                 ++itr;
             }
-            if constexpr (_same_order_v<Cont>) {
-                first = std::next(_container.begin(), dist);
-            } else if constexpr (!concepts::Reservable<Container>) {
+            if constexpr (!concepts::Reservable<Container>) {
                 first = _container.begin();
             }
         }
         return std::next(_container.begin(), len);
     }
 
-    template <typename Cont, typename Cond>
-    void _merge(Cont& source, [[maybe_unused]] Cond multimap) {
-        if constexpr (concepts::Reservable<Container>) {
-            auto const require = size() + source.size();
-            auto const opt_cap = (~0ull >> __builtin_clzll(require - 1)) + 1;
+    // Same as above for source in the same order, but walks both at once in linear time.
+    // The rejected elements are packed to the front of a flat source in the same pass, instead of
+    // erasing the moved ones one by one.
+    template <typename Cont>
+    iterator _move_distinct_elements_linear(Cont& source) {
+        using source_iterator = typename Cont::iterator;
+        using source_value    = typename std::iterator_traits<source_iterator>::value_type;
+        constexpr bool compact_v = std::is_base_of_v<
+            std::random_access_iterator_tag,
+            typename std::iterator_traits<source_iterator>::iterator_category>;
+
+        auto const& comp = this->_comp();
+        auto const  len  = _container.size();
+        size_type   pos  = 0;
+        auto        out  = source.begin();
+        for (auto itr = source.begin(); itr != source.end();) {
+            auto const& key    = Subclass::_key_extractor(*itr);
+            auto        target = std::next(_container.begin(), pos);
+            while (pos < len && comp(Subclass::_key_extractor(*target), key)) {
+                ++pos;
+                ++target;
+            }
+            // Elements equivalent to the last moved one come from a multi source.
+            if ((pos < len && !comp(key, Subclass::_key_extractor(*target)))
+                || (_container.size() > len
+                    && !comp(Subclass::_key_extractor(*std::prev(_container.end())), key))) {
+                if constexpr (compact_v) {
+                    if (out != itr) {
+                        *out = std::move(*itr);
+                    }
+                    ++out;
+                }
+                ++itr;
+                continue;
+            }
+            source_value tmp = std::move(*itr);
+            if constexpr (compact_v) {
+                ++itr;
+            } else {
+                itr = source.erase(itr);
+            }
+            _container.emplace(_container.end(), std::move(tmp));
+        }
+        if constexpr (compact_v) {
+            source.erase(out, source.end());
+        }
+        return std::next(_container.begin(), len);
+    }
+
+    template <typename Cont>
+    static constexpr bool _is_distinct_back_mergeable_v =
+        _same_order_v<Cont> && _is_back_mergeable_v<std::move_iterator<typename Cont::iterator>>
+        && (!std::is_base_of_v<
+                std::random_access_iterator_tag,
+                typename std::iterator_traits<typename Cont::iterator>::iterator_category>
+            || std::is_nothrow_move_assignable_v<typename Cont::value_type>);
+
+    // Same as _move_distinct_elements_linear followed by merging, but moves each distinct element
+    // straight into its final position. They are counted by a forward pass first, so that the
+    // container grows exactly once, and then merged by a backward pass, which also packs the
+    // rejected elements to the front of a flat source.
+    // If an exception is thrown, both of the container and source are left without gaps.
+    template <typename Cont>
+    void _merge_distinct_back(Cont& source) {
+        using source_iterator    = typename Cont::iterator;
+        constexpr bool compact_v = std::is_base_of_v<
+            std::random_access_iterator_tag,
+            typename std::iterator_traits<source_iterator>::iterator_category>;
+
+        auto const& comp = this->_comp();
+
+        // Elements equivalent to an existing one or the preceding one in source are rejected.
+        auto const count = _count_distinct(source.begin(), source.end());
+
+        auto const len = _container.size();
+        _container.resize(len + count);
+
+        auto mid    = std::next(_container.begin(), len);
+        auto out    = _container.end();
+        auto itr    = source.end();
+        auto packed = source.end();  // [itr, packed) are moved from if source is flat
+        auto const close_gaps = [&] {
+            if (out != mid) {
+                _container.erase(std::move(out, _container.end(), mid), _container.end());
+            }
+            if constexpr (compact_v) {
+                source.erase(itr, packed);
+            }
+        };
+
+        try {
+            while (out != mid) {
+                auto const  prev = std::prev(itr);
+                auto const& key  = Subclass::_key_extractor(*prev);
+                if (mid != _container.begin()
+                    && comp(key, Subclass::_key_extractor(*std::prev(mid)))) {
+                    *--out = std::move(*--mid);
+                    continue;
+                }
+                if ((mid != _container.begin()
+                     && !comp(Subclass::_key_extractor(*std::prev(mid)), key))
+                    || (prev != source.begin()
+                        && !comp(Subclass::_key_extractor(*std::prev(prev)), key))) {
+                    if constexpr (compact_v) {
+                        if (--packed != prev) {
+                            *packed = std::move(*prev);
+                        }
+                    }
+                    itr = prev;
+                    continue;
+                }
+                if constexpr (std::is_same_v<std::decay_t<decltype(*prev)>, value_type>) {
+                    *std::prev(out) = std::move(*prev);
+                } else {
+                    *std::prev(out) = value_type(std::move(*prev));
+                }
+                --out;
+                if constexpr (compact_v) {
+                    itr = prev;
+                } else {
+                    source.erase(prev);
+                }
+            }
+        } catch (...) {
+            close_gaps();
+            throw;
+        }
+        close_gaps();
+    }
+
+    // Reserves the next power of two of require unless it fits already, so that repeated merges
+    // don't reallocate every time. Bounded containers can't reserve beyond their capacity, even if
+    // the result fits.
+    void _grow_for(size_type require) {
+        if constexpr (concepts::Reservable<Container> && !concepts::Bounded<Container>) {
+            if constexpr (concepts::HasCapacity<Container>) {
+                if (_container.capacity() >= require) {
+                    return;
+                }
+            }
+            auto const opt_cap = require > 1 ? (~0ull >> __builtin_clzll(require - 1)) + 1 : require;
             _container.reserve(opt_cap);
         }
+    }
+
+    template <typename Cont, typename Cond>
+    void _merge(Cont& source, [[maybe_unused]] Cond multimap) {
+        _grow_for(size() + source.size());
 
         iterator mid;
         if constexpr (Subclass::_order == range_order::unique_sorted) {
-            mid = _move_distinct_elements(source, multimap);
-            if constexpr (!_same_order_v<Cont>) {
+            if constexpr (_is_distinct_back_mergeable_v<Cont>) {
+                _merge_distinct_back(source);
+                return;
+            } else if constexpr (_same_order_v<Cont>) {
+                mid = _move_distinct_elements_linear(source);
+            } else {
+                mid = _move_distinct_elements(source, multimap);
                 std::sort(mid, _container.end(), _vcomp());
             }
+        } else if constexpr (
+            _same_order_v<Cont>
+            && _is_back_mergeable_v<std::move_iterator<typename Cont::iterator>>
+        ) {
+            _merge_back(
+                std::make_move_iterator(source.begin()), std::make_move_iterator(source.end())
+            );
+            source.clear();
+            return;
         } else {
             mid = _container.insert(
                 _container.end(),
@@ -423,17 +1140,184 @@ class _flat_tree_base : private detail::comparator_store<Compare> {
                 std::make_move_iterator(source.end())
             );
             if constexpr (!_same_order_v<Cont>) {
-                std::stable_sort(mid, _container.end(), _vcomp());
+                _stable_sort(mid, _container.end());
             }
         }
 
-        std::inplace_merge(_container.begin(), mid, _container.end(), _vcomp());
+        _merge_tail(mid);
 
         if constexpr (Subclass::_order != range_order::unique_sorted) {
             source.clear();  // clear at last for cache awareness
         }
     }
 
+    // Merges all of sources at once by a k-way merge over a tournament tree of their heads, which
+    // moves each element only once. Ties are broken by the position of the source with this
+    // container first, so that unique containers keep the first one and multi containers are
+    // stable. As merge, rejected elements are left in their sources.
+    // The container grows once to hold all of them, and its own elements are moved to the tail, so
+    // that the merged ones are written from the front without overtaking the unmerged ones. If an
+    // exception is thrown, the gap between them is closed.
+    template <typename Range>
+    void _merge_all(Range& sources) {
+        using source_type = std::remove_reference_t<decltype(*std::begin(sources))>;
+
+        std::size_t k     = 0;
+        size_type   total = 0;
+        for (auto& source : sources) {
+            k += !source.empty();
+            total += source.size();
+        }
+
+        auto const merge_each = [&] {
+            _grow_for(size() + total);
+            for (auto& source : sources) {
+                static_cast<Subclass*>(this)->merge(source);
+            }
+        };
+
+        // Bounded containers may not have room for all of sources, even if the result fits.
+        if constexpr (
+            !_is_distinct_back_mergeable_v<source_type> || concepts::Bounded<Container>
+        ) {
+            merge_each();
+        } else {
+            if (k < detail::k_way_merge_threshold_v<
+                        value_type,
+                        Subclass::_order == range_order::unique_sorted>) {
+                merge_each();
+                return;
+            }
+
+            using source_iterator = typename source_type::iterator;
+            constexpr bool compact_v = std::is_base_of_v<
+                std::random_access_iterator_tag,
+                typename std::iterator_traits<source_iterator>::iterator_category>;
+
+            using key_ptr = std::remove_reference_t<
+                decltype(Subclass::_key_extractor(*std::declval<source_iterator>()))> const*;
+            struct cursor {
+                source_type*    source;
+                source_iterator itr;
+                source_iterator out;
+                key_ptr         key;  // null if exhausted
+            };
+
+            std::vector<cursor> cursors;
+            cursors.reserve(k);
+            for (auto& source : sources) {
+                if (!source.empty()) {
+                    cursors.push_back(
+                        {&source,
+                         source.begin(),
+                         source.begin(),
+                         &Subclass::_key_extractor(*source.begin())}
+                    );
+                }
+            }
+
+            auto const& comp   = this->_comp();
+            auto const  before = [&](std::size_t l, std::size_t r) {
+                auto const lk = cursors[l].key;
+                auto const rk = cursors[r].key;
+                return !rk || (lk && (comp(*lk, *rk) || (!comp(*rk, *lk) && l < r)));
+            };
+
+            // Tournament tree of the heads, where losers[0] is the winner and losers[n] is the
+            // loser at the node n, whose children are 2n and 2n + 1, and leaves are from k.
+            std::vector<std::size_t> losers(k);
+            auto const               play = [&](std::size_t node, auto& recurse) -> std::size_t {
+                if (node >= k) {
+                    return node - k;
+                }
+                auto l = recurse(node * 2, recurse);
+                auto r = recurse(node * 2 + 1, recurse);
+                if (before(r, l)) {
+                    std::swap(l, r);
+                }
+                losers[node] = r;
+                return l;
+            };
+            losers[0] = play(1, play);
+            auto const replay = [&](std::size_t winner) {
+                for (auto node = (winner + k) / 2; node > 0; node /= 2) {
+                    auto const loser = losers[node];
+                    bool const swap  = before(loser, winner);
+                    losers[node]     = swap ? winner : loser;
+                    winner           = swap ? loser : winner;
+                }
+                losers[0] = winner;
+            };
+
+            auto const len = size();
+            _container.resize(len + total);
+            auto out  = _container.begin();
+            auto self = std::move_backward(
+                _container.begin(), std::next(_container.begin(), len), _container.end()
+            );
+            auto const close_gaps = [&] {
+                auto const tail = out != self ? std::move(self, _container.end(), out)
+                                              : _container.end();
+                _container.erase(tail, _container.end());
+                if constexpr (compact_v) {
+                    for (auto& c : cursors) {
+                        c.source->erase(c.out, c.itr);
+                    }
+                }
+            };
+
+            try {
+                while (cursors[losers[0]].key) {
+                    auto&       c   = cursors[losers[0]];
+                    auto const& key = *c.key;
+                    auto const  not_after = [&] {
+                        return self != _container.end()
+                               && !comp(key, Subclass::_key_extractor(*self));
+                    };
+                    if (not_after()) {
+                        auto const run = self;
+                        do {
+                            ++self;
+                        } while (not_after());
+                        out = std::move(run, self, out);
+                        continue;
+                    }
+
+                    if (Subclass::_order == range_order::unique_sorted
+                        && out != _container.begin()
+                        && !comp(Subclass::_key_extractor(*std::prev(out)), key)) {
+                        if constexpr (compact_v) {
+                            if (c.out != c.itr) {
+                                *c.out = std::move(*c.itr);
+                            }
+                            ++c.out;
+                        }
+                        ++c.itr;
+                    } else {
+                        if constexpr (std::is_same_v<std::decay_t<decltype(*c.itr)>, value_type>) {
+                            *out = std::move(*c.itr);
+                        } else {
+                            *out = value_type(std::move(*c.itr));
+                        }
+                        ++out;
+                        if constexpr (compact_v) {
+                            ++c.itr;
+                        } else {
+                            c.itr = c.source->erase(c.itr);
+                        }
+                    }
+
+                    c.key = c.itr != c.source->end() ? &Subclass::_key_extractor(*c.itr) : nullptr;
+                    replay(losers[0]);
+                }
+            } catch (...) {
+                close_gaps();
+                throw;
+            }
+            close_gaps();
+        }
+    }
+
    private:
     template <typename K, typename U>
     using enable_if_transparent = std::enable_if_t<
@@ -442,110 +1326,276 @@ class _flat_tree_base : private detail::comparator_store<Compare> {
 
    public:
     template <typename K>
-    size_type _count(K const& key) const {
+    constexpr size_type _count(K const& key) const {
         auto [first, last] = equal_range(key);
         return std::distance(first, last);
     }
 
-    size_type count(key_type const& key) const { return _count(key); }
+    constexpr size_type count(key_type const& key) const { return _count(key); }
 
     template <typename K>
-    enable_if_transparent<K, size_type> count(K const& key) const {
+    constexpr enable_if_transparent<K, size_type> count(K const& key) const {
         return _count(key);
     }
 
-    iterator find(key_type const& key) {
+    constexpr iterator find(key_type const& key) {
         auto [itr, found] = _find(key);
         return found ? itr : end();
     }
 
-    const_iterator find(key_type const& key) const {
+    constexpr const_iterator find(key_type const& key) const {
         return const_cast<_flat_tree_base*>(this)->find(key);
     }
 
     template <typename K>
-    enable_if_transparent<K, iterator> find(K const& key) {
+    constexpr enable_if_transparent<K, iterator> find(K const& key) {
         auto [itr, found] = _find(key);
         return found ? itr : end();
     }
 
     template <typename K>
-    enable_if_transparent<K, const_iterator> find(K const& key) const {
+    constexpr enable_if_transparent<K, const_iterator> find(K const& key) const {
         return const_cast<_flat_tree_base*>(this)->template find<K>(key);
     }
 
-    bool contains(key_type const& key) const { return _find(key).second; }
+    constexpr bool contains(key_type const& key) const { return _find(key).second; }
 
     template <typename K>
-    enable_if_transparent<K, bool> contains(K const& key) const {
+    constexpr enable_if_transparent<K, bool> contains(K const& key) const {
         return _find(key).second;
     }
 
     template <typename K>
-    std::pair<iterator, iterator> _equal_range(K const& key) {
+    constexpr std::pair<iterator, iterator> _equal_range(K const& key) {
         if constexpr (Subclass::_order == range_order::unique_sorted) {
             auto [itr, found] = _find(key);
             return {itr, found ? std::next(itr) : itr};
         } else {
-            return std::equal_range(begin(), end(), key, _vcomp());
+            auto first = _lower_bound(begin(), end(), key);
+            return {first, _upper_bound(first, end(), key)};
         }
     }
 
-    std::pair<iterator, iterator> equal_range(key_type const& key) { return _equal_range(key); }
+    constexpr std::pair<iterator, iterator> equal_range(key_type const& key) {
+        return _equal_range(key);
+    }
 
-    std::pair<const_iterator, const_iterator> equal_range(key_type const& key) const {
+    constexpr std::pair<const_iterator, const_iterator> equal_range(key_type const& key) const {
         return const_cast<_flat_tree_base*>(this)->equal_range(key);
     }
 
     template <typename K>
-    enable_if_transparent<K, std::pair<iterator, iterator>> equal_range(K const& key) {
+    constexpr enable_if_transparent<K, std::pair<iterator, iterator>> equal_range(K const& key) {
         return _equal_range(key);
     }
 
     template <typename K>
-    enable_if_transparent<K, std::pair<const_iterator, const_iterator>> equal_range(K const& key
+    constexpr enable_if_transparent<K, std::pair<const_iterator, const_iterator>> equal_range(
+        K const& key
     ) const {
         return const_cast<_flat_tree_base*>(this)->template equal_range<K>(key);
     }
 
-    iterator lower_bound(key_type const& key) {
-        return std::lower_bound(begin(), end(), key, _vcomp());
+    constexpr iterator lower_bound(key_type const& key) {
+        return _lower_bound(begin(), end(), key);
     }
 
-    const_iterator lower_bound(key_type const& key) const {
+    constexpr const_iterator lower_bound(key_type const& key) const {
         return const_cast<_flat_tree_base*>(this)->lower_bound(key);
     }
 
     template <typename K>
-    enable_if_transparent<K, iterator> lower_bound(K const& key) {
-        return std::lower_bound(begin(), end(), key, _vcomp());
+    constexpr enable_if_transparent<K, iterator> lower_bound(K const& key) {
+        return _lower_bound(begin(), end(), key);
     }
 
     template <typename K>
-    enable_if_transparent<K, const_iterator> lower_bound(K const& key) const {
+    constexpr enable_if_transparent<K, const_iterator> lower_bound(K const& key) const {
         return const_cast<_flat_tree_base*>(this)->template lower_bound<K>(key);
     }
 
-    iterator upper_bound(key_type const& key) {
-        return std::upper_bound(begin(), end(), key, _vcomp());
+    constexpr iterator upper_bound(key_type const& key) {
+        return _upper_bound(begin(), end(), key);
     }
 
-    const_iterator upper_bound(key_type const& key) const {
+    constexpr const_iterator upper_bound(key_type const& key) const {
         return const_cast<_flat_tree_base*>(this)->upper_bound(key);
     }
 
     template <typename K>
-    enable_if_transparent<K, iterator> upper_bound(K const& key) {
-        return std::upper_bound(begin(), end(), key, _vcomp());
+    constexpr enable_if_transparent<K, iterator> upper_bound(K const& key) {
+        return _upper_bound(begin(), end(), key);
     }
 
     template <typename K>
-    enable_if_transparent<K, const_iterator> upper_bound(K const& key) const {
+    constexpr enable_if_transparent<K, const_iterator> upper_bound(K const& key) const {
         return const_cast<_flat_tree_base*>(this)->template upper_bound<K>(key);
     }
 
-    key_compare key_comp() const { return this->_comp(); }
-    auto        value_comp() { return static_cast<typename Subclass::value_compare>(_vcomp()); }
+   private:
+    // Number of searches interleaved by _lower_bound_many for unordered keys.
+    static constexpr std::size_t _batch_size = 16;
+    // Sorted keys are galloped rather than batched if they are denser than 1 in this many elements.
+    static constexpr size_type _gallop_density = 32;
+
+    void _prefetch(const_iterator itr) const noexcept {
+        __builtin_prefetch(std::addressof(Subclass::_key_extractor(*itr)));
+    }
+
+    // Lower bound of key in [first, end()), probing first + 0, 1, 3, 7, ... before bisecting.
+    template <typename K>
+    iterator _gallop(iterator first, K const& key) {
+        auto const n     = static_cast<size_type>(std::distance(first, end()));
+        size_type  lo    = 0;
+        size_type  bound = 0;
+        while (bound < n && _vcomp()(first[bound], key)) {
+            lo    = bound + 1;
+            bound = bound * 2 + 1;
+        }
+        return _lower_bound(std::next(first, lo), std::next(first, std::min(bound, n)), key);
+    }
+
+    // Writes f(lower_bound(key), key) to out for each key in [first, last).
+    template <typename ForwardIterator, typename OutputIterator, typename F>
+    OutputIterator _lower_bound_many(
+        range_order order, ForwardIterator first, ForwardIterator last, OutputIterator out, F f
+    ) {
+        auto const sorted = order == range_order::sorted || order == range_order::unique_sorted;
+        auto const m      = static_cast<size_type>(std::distance(first, last));
+        if (sorted && m * _gallop_density >= size()) {
+            // Each lower bound is not less than the previous one, so gallop from there.
+            for (auto lb = begin(); first != last; ++first) {
+                lb     = _gallop(lb, *first);
+                *out++ = f(lb, *first);
+            }
+            return out;
+        }
+
+        // Bisect a batch of keys in lockstep, so that the cache misses of each step overlap.
+        auto const head = begin();
+        while (first != last) {
+            ForwardIterator keys[_batch_size];
+            size_type       base[_batch_size];
+            std::size_t     m = 0;
+            for (; m < _batch_size && first != last; ++m, ++first) {
+                keys[m] = first;
+                base[m] = 0;
+            }
+
+            auto n = size();
+            while (n > 1) {
+                auto const half = n / 2;
+                n -= half;
+                for (std::size_t i = 0; i < m; ++i) {
+                    base[i] += _vcomp()(head[base[i] + half], *keys[i]) ? half : 0;
+                    _prefetch(std::next(head, base[i] + n / 2));
+                }
+            }
+            for (std::size_t i = 0; i < m; ++i) {
+                auto const pos = base[i] + (n == 1 && _vcomp()(head[base[i]], *keys[i]));
+                *out++         = f(std::next(head, pos), *keys[i]);
+            }
+        }
+        return out;
+    }
+
+    template <typename K>
+    bool _is_found(const_iterator itr, K const& key) const {
+        return !(itr == end() || _vcomp()(key, *itr));
+    }
+
+   public:
+    // extension
+    template <typename ForwardIterator, typename OutputIterator>
+    OutputIterator find_many(ForwardIterator first, ForwardIterator last, OutputIterator out) {
+        return find_many(range_order::no_ordered, first, last, out);
+    }
+
+    // extension
+    template <typename ForwardIterator, typename OutputIterator>
+    OutputIterator find_many(
+        range_order order, ForwardIterator first, ForwardIterator last, OutputIterator out
+    ) {
+        return _lower_bound_many(order, first, last, out, [this](iterator itr, auto const& key) {
+            return _is_found(itr, key) ? itr : end();
+        });
+    }
+
+    // extension
+    template <typename ForwardIterator, typename OutputIterator>
+    OutputIterator find_many(ForwardIterator first, ForwardIterator last, OutputIterator out)
+        const {
+        return find_many(range_order::no_ordered, first, last, out);
+    }
+
+    // extension
+    template <typename ForwardIterator, typename OutputIterator>
+    OutputIterator find_many(
+        range_order order, ForwardIterator first, ForwardIterator last, OutputIterator out
+    ) const {
+        auto self = const_cast<_flat_tree_base*>(this);
+        return self->_lower_bound_many(order, first, last, out, [this](iterator itr, auto& key) {
+            return _is_found(itr, key) ? const_iterator(itr) : end();
+        });
+    }
+
+    // extension
+    template <typename ForwardIterator, typename OutputIterator>
+    OutputIterator contains_many(ForwardIterator first, ForwardIterator last, OutputIterator out)
+        const {
+        return contains_many(range_order::no_ordered, first, last, out);
+    }
+
+    // extension
+    template <typename ForwardIterator, typename OutputIterator>
+    OutputIterator contains_many(
+        range_order order, ForwardIterator first, ForwardIterator last, OutputIterator out
+    ) const {
+        auto self = const_cast<_flat_tree_base*>(this);
+        return self->_lower_bound_many(order, first, last, out, [this](iterator itr, auto& key) {
+            return _is_found(itr, key);
+        });
+    }
+
+    // extension
+    template <typename ForwardIterator, typename OutputIterator>
+    OutputIterator lower_bound_many(
+        ForwardIterator first, ForwardIterator last, OutputIterator out
+    ) {
+        return lower_bound_many(range_order::no_ordered, first, last, out);
+    }
+
+    // extension
+    template <typename ForwardIterator, typename OutputIterator>
+    OutputIterator lower_bound_many(
+        range_order order, ForwardIterator first, ForwardIterator last, OutputIterator out
+    ) {
+        return _lower_bound_many(order, first, last, out, [](iterator itr, auto&) { return itr; });
+    }
+
+    // extension
+    template <typename ForwardIterator, typename OutputIterator>
+    OutputIterator lower_bound_many(
+        ForwardIterator first, ForwardIterator last, OutputIterator out
+    ) const {
+        return lower_bound_many(range_order::no_ordered, first, last, out);
+    }
+
+    // extension
+    template <typename ForwardIterator, typename OutputIterator>
+    OutputIterator lower_bound_many(
+        range_order order, ForwardIterator first, ForwardIterator last, OutputIterator out
+    ) const {
+        auto self = const_cast<_flat_tree_base*>(this);
+        return self->_lower_bound_many(order, first, last, out, [](iterator itr, auto&) {
+            return const_iterator(itr);
+        });
+    }
+
+    constexpr key_compare key_comp() const { return this->_comp(); }
+    constexpr auto        value_comp() {
+        return static_cast<typename Subclass::value_compare>(_vcomp());
+    }
 };
 
 }  // namespace flat_map::detail
@@ -51,4 +51,6 @@ template <typename Key, typename Compare, typename Container>
 class flat_multiset;
 template <typename... Sequences>
 class tied_sequence;
+template <typename... Ts>
+class columnar_sequence;
 }  // namespace flat_map
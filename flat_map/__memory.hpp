@@ -7,6 +7,7 @@
 #include <new>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 
 namespace flat_map {
 
@@ -67,6 +68,16 @@ struct fake_allocator : private AllocatorTuple {
     }
 };
 
+// std::construct_at if available, which is usable in constant evaluation.
+template <typename T, typename... Args>
+constexpr T* construct_at(T* p, Args&&... args) {
+#ifdef __cpp_lib_constexpr_dynamic_alloc
+    return std::construct_at(p, std::forward<Args>(args)...);
+#else
+    return ::new (static_cast<void*>(p)) T(std::forward<Args>(args)...);
+#endif
+}
+
 }  // namespace detail
 
 template <typename... Allocators>
@@ -0,0 +1,100 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "flat_map/__radix_sort.hpp"
+
+namespace flat_map::detail {
+
+// Moves elements of a column so that i-th element becomes the one at perm[i].
+template <typename RandomAccessIterator>
+void permute_column(RandomAccessIterator first, std::vector<std::size_t> const& perm) {
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+
+    std::vector<value_type> buffer;
+    buffer.reserve(perm.size());
+    for (auto const i : perm) {
+        buffer.push_back(std::move(first[i]));
+    }
+    std::move(buffer.begin(), buffer.end(), first);
+}
+
+// Stable permutation which sorts keys[0, n) by comp.
+// Trivially copyable keys are sorted together with their indices, so that the comparison doesn't
+// chase indices. Otherwise indices are sorted by the keys they refer.
+template <typename Key, typename Compare, typename RandomAccessIterator>
+std::vector<std::size_t> sorted_permutation(
+    RandomAccessIterator keys, std::size_t n, Compare const& comp
+) {
+    std::vector<std::size_t> perm(n);
+    if constexpr (std::is_trivially_copyable_v<Key>) {
+        std::vector<std::pair<Key, std::size_t>> entries;
+        entries.reserve(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            entries.emplace_back(keys[i], i);
+        }
+
+        auto const by_key = [&comp](auto const& lhs, auto const& rhs) {
+            return comp(lhs.first, rhs.first);
+        };
+        if constexpr (is_radix_sortable_v<Key, Compare>) {
+            if (n >= radix_sort_threshold) {
+                radix_sort<Key, Compare>(entries.begin(), entries.end(), [](auto const& entry) {
+                    return entry.first;
+                });
+            } else {
+                std::stable_sort(entries.begin(), entries.end(), by_key);
+            }
+        } else {
+            std::stable_sort(entries.begin(), entries.end(), by_key);
+        }
+        std::transform(entries.begin(), entries.end(), perm.begin(), [](auto const& entry) {
+            return entry.second;
+        });
+    } else {
+        std::iota(perm.begin(), perm.end(), std::size_t(0));
+        std::stable_sort(perm.begin(), perm.end(), [&comp, keys](auto lhs, auto rhs) {
+            return comp(keys[lhs], keys[rhs]);
+        });
+    }
+    return perm;
+}
+
+template <typename ZipIterator, std::size_t... N>
+void permute_columns(
+    ZipIterator first, std::vector<std::size_t> const& perm, std::index_sequence<N...>
+) {
+    (permute_column(first.template get_iterator<N>(), perm), ...);
+}
+
+// Stable sort of a zipped range [first, last) whose first column holds Key.
+// Instead of swapping rows across all columns on each move, this sorts a permutation by the key
+// column and then moves each column into place once.
+template <typename Key, typename Compare, typename ZipIterator>
+void permutation_sort(ZipIterator first, ZipIterator last, Compare const& comp) {
+    using value_type = typename std::iterator_traits<ZipIterator>::value_type;
+    using indices_t  = std::make_index_sequence<std::tuple_size_v<value_type>>;
+
+    auto const n = static_cast<std::size_t>(std::distance(first, last));
+    if (n < 2) {
+        return;
+    }
+
+    auto const perm = sorted_permutation<Key>(first.template get_iterator<0>(), n, comp);
+    if (std::is_sorted(perm.begin(), perm.end())) {
+        return;
+    }
+    permute_columns(first, perm, indices_t{});
+}
+
+}  // namespace flat_map::detail
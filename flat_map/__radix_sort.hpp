@@ -0,0 +1,147 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace flat_map::detail {
+
+// Maps Key to an unsigned integer of the same width, preserving the order.
+template <typename Key, typename = void>
+struct radix_key_traits {
+    static constexpr bool sortable = false;
+};
+
+template <typename Key>
+struct radix_key_traits<
+    Key,
+    std::enable_if_t<std::is_integral_v<Key> && !std::is_same_v<Key, bool>>> {
+    static constexpr bool sortable = true;
+    using type                     = std::make_unsigned_t<Key>;
+
+    static type encode(Key key) noexcept {
+        constexpr auto sign = std::is_signed_v<Key> ? type(type(1) << (sizeof(Key) * 8 - 1)) : 0;
+        return static_cast<type>(static_cast<type>(key) ^ sign);
+    }
+};
+
+template <typename Key>
+struct radix_key_traits<
+    Key,
+    std::enable_if_t<
+        std::is_floating_point_v<Key> && std::numeric_limits<Key>::is_iec559
+        && (sizeof(Key) == 4 || sizeof(Key) == 8)>> {
+    static constexpr bool sortable = true;
+    using type = std::conditional_t<sizeof(Key) == 4, std::uint32_t, std::uint64_t>;
+
+    // Negative values are ordered reversely by their bits, so flip all of them.
+    // -0.0 is equivalent to +0.0 on comparison, so encode it as +0.0 to keep the sort stable.
+    static type encode(Key key) noexcept {
+        constexpr auto sign = type(type(1) << (sizeof(Key) * 8 - 1));
+        if (key == Key(0)) {
+            key = Key(0);
+        }
+        type bits;
+        std::memcpy(&bits, &key, sizeof(bits));
+        return (bits & sign) ? type(~bits) : type(bits | sign);
+    }
+};
+
+// 1 or -1 if elements ordered by Compare on Key can be radix sorted in ascending or descending
+// order respectively, otherwise 0.
+template <typename Key, typename Compare>
+constexpr int radix_direction() noexcept {
+    if constexpr (!radix_key_traits<Key>::sortable) {
+        return 0;
+    } else if constexpr (
+        std::is_same_v<Compare, std::less<Key>> || std::is_same_v<Compare, std::less<>>
+    ) {
+        return 1;
+    } else if constexpr (
+        std::is_same_v<Compare, std::greater<Key>> || std::is_same_v<Compare, std::greater<>>
+    ) {
+        return -1;
+    } else {
+        return 0;
+    }
+}
+
+template <typename Key, typename Compare>
+inline constexpr bool is_radix_sortable_v = radix_direction<Key, Compare>() != 0;
+
+// Shorter ranges are sorted by comparison, as radix sort has to allocate and count.
+inline constexpr std::size_t radix_sort_threshold = 1024;
+
+// Stable LSD radix sort of [first, last) on 8 bit digits of key(element).
+// The elements are moved into a buffer and scattered back and forth between two buffers, so
+// value_type should be default constructible.
+template <typename Key, typename Compare, typename RandomAccessIterator, typename KeyExtractor>
+void radix_sort(RandomAccessIterator first, RandomAccessIterator last, KeyExtractor key) {
+    using traits     = radix_key_traits<Key>;
+    using code_type  = typename traits::type;
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+
+    constexpr std::size_t passes = sizeof(code_type);
+
+    auto const code = [&key](auto const& value) {
+        auto const c = traits::encode(key(value));
+        return radix_direction<Key, Compare>() < 0 ? static_cast<code_type>(~c) : c;
+    };
+    auto const digit = [](code_type c, std::size_t pass) {
+        return static_cast<std::size_t>((c >> (pass * 8)) & 0xff);
+    };
+
+    auto const n = static_cast<std::size_t>(std::distance(first, last));
+    if (n < 2) {
+        return;
+    }
+
+    std::array<std::array<std::size_t, 256>, passes> counts{};
+    for (std::size_t i = 0; i < n; ++i) {
+        auto const c = code(first[i]);
+        for (std::size_t p = 0; p < passes; ++p) {
+            ++counts[p][digit(c, p)];
+        }
+    }
+
+    // Passes on which every element has the same digit wouldn't change the order.
+    auto const first_code = code(first[0]);
+    auto       remaining  = std::size_t(0);
+    for (std::size_t p = 0; p < passes; ++p) {
+        remaining += counts[p][digit(first_code, p)] != n;
+    }
+    if (remaining == 0) {
+        return;
+    }
+
+    std::vector<value_type> source(std::make_move_iterator(first), std::make_move_iterator(last));
+    std::vector<value_type> buffer(n);
+    for (std::size_t p = 0; p < passes; ++p) {
+        auto& count = counts[p];
+        if (count[digit(first_code, p)] == n) {
+            continue;
+        }
+        std::size_t offset = 0;
+        for (auto& c : count) {
+            offset += std::exchange(c, offset);
+        }
+        for (auto& value : source) {
+            buffer[count[digit(code(value), p)]++] = std::move(value);
+        }
+        source.swap(buffer);
+    }
+    std::move(source.begin(), source.end(), first);
+}
+
+}  // namespace flat_map::detail
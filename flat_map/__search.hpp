@@ -0,0 +1,211 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#    include <immintrin.h>
+#endif
+
+namespace flat_map::detail {
+
+// Whether lookups of K on sorted contiguous Key can be done by comparing raw values.
+template <typename Key, typename Compare, typename K>
+inline constexpr bool is_simd_searchable_v =
+    std::is_same_v<K, Key> && std::is_arithmetic_v<Key> && !std::is_same_v<Key, bool>
+    && (sizeof(Key) == 4 || sizeof(Key) == 8)
+    && (std::is_same_v<Compare, std::less<Key>> || std::is_same_v<Compare, std::less<>>);
+
+// Vector operations on T; lanes == 0 means no vector unit is available for T.
+template <typename T, typename = void>
+struct simd_ops {
+    static constexpr std::size_t lanes = 0;
+};
+
+#if defined(__AVX2__)
+
+template <typename T>
+struct simd_ops<T, std::enable_if_t<std::is_integral_v<T> && sizeof(T) == 4>> {
+    using vector_type                  = __m256i;
+    static constexpr std::size_t lanes = 8;
+    static constexpr unsigned    full  = 0xffu;
+
+    // Flip the sign bit so that unsigned values are ordered by signed comparison.
+    static vector_type bias() noexcept {
+        return _mm256_set1_epi32(std::is_signed_v<T> ? 0 : INT32_MIN);
+    }
+    static vector_type load(T const* p) noexcept {
+        return _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(p)), bias());
+    }
+    static vector_type splat(T v) noexcept {
+        return _mm256_xor_si256(_mm256_set1_epi32(static_cast<std::int32_t>(v)), bias());
+    }
+    static unsigned less(vector_type a, vector_type b) noexcept {
+        auto const m = _mm256_cmpgt_epi32(b, a);
+        return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(m)));
+    }
+};
+
+template <typename T>
+struct simd_ops<T, std::enable_if_t<std::is_integral_v<T> && sizeof(T) == 8>> {
+    using vector_type                  = __m256i;
+    static constexpr std::size_t lanes = 4;
+    static constexpr unsigned    full  = 0xfu;
+
+    static vector_type bias() noexcept {
+        return _mm256_set1_epi64x(std::is_signed_v<T> ? 0 : INT64_MIN);
+    }
+    static vector_type load(T const* p) noexcept {
+        return _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(p)), bias());
+    }
+    static vector_type splat(T v) noexcept {
+        return _mm256_xor_si256(_mm256_set1_epi64x(static_cast<std::int64_t>(v)), bias());
+    }
+    static unsigned less(vector_type a, vector_type b) noexcept {
+        auto const m = _mm256_cmpgt_epi64(b, a);
+        return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(m)));
+    }
+};
+
+template <>
+struct simd_ops<float> {
+    using vector_type                  = __m256;
+    static constexpr std::size_t lanes = 8;
+    static constexpr unsigned    full  = 0xffu;
+
+    static vector_type load(float const* p) noexcept { return _mm256_loadu_ps(p); }
+    static vector_type splat(float v) noexcept { return _mm256_set1_ps(v); }
+    static unsigned    less(vector_type a, vector_type b) noexcept {
+        return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LT_OQ)));
+    }
+};
+
+template <>
+struct simd_ops<double> {
+    using vector_type                  = __m256d;
+    static constexpr std::size_t lanes = 4;
+    static constexpr unsigned    full  = 0xfu;
+
+    static vector_type load(double const* p) noexcept { return _mm256_loadu_pd(p); }
+    static vector_type splat(double v) noexcept { return _mm256_set1_pd(v); }
+    static unsigned    less(vector_type a, vector_type b) noexcept {
+        return static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_LT_OQ)));
+    }
+};
+
+#elif defined(__SSE2__)
+
+template <typename T>
+struct simd_ops<T, std::enable_if_t<std::is_integral_v<T> && sizeof(T) == 4>> {
+    using vector_type                  = __m128i;
+    static constexpr std::size_t lanes = 4;
+    static constexpr unsigned    full  = 0xfu;
+
+    // Flip the sign bit so that unsigned values are ordered by signed comparison.
+    static vector_type bias() noexcept {
+        return _mm_set1_epi32(std::is_signed_v<T> ? 0 : INT32_MIN);
+    }
+    static vector_type load(T const* p) noexcept {
+        return _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p)), bias());
+    }
+    static vector_type splat(T v) noexcept {
+        return _mm_xor_si128(_mm_set1_epi32(static_cast<std::int32_t>(v)), bias());
+    }
+    static unsigned less(vector_type a, vector_type b) noexcept {
+        return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(a, b))));
+    }
+};
+
+#    if defined(__SSE4_2__)
+template <typename T>
+struct simd_ops<T, std::enable_if_t<std::is_integral_v<T> && sizeof(T) == 8>> {
+    using vector_type                  = __m128i;
+    static constexpr std::size_t lanes = 2;
+    static constexpr unsigned    full  = 0x3u;
+
+    static vector_type bias() noexcept {
+        return _mm_set1_epi64x(std::is_signed_v<T> ? 0 : INT64_MIN);
+    }
+    static vector_type load(T const* p) noexcept {
+        return _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p)), bias());
+    }
+    static vector_type splat(T v) noexcept {
+        return _mm_xor_si128(_mm_set1_epi64x(static_cast<std::int64_t>(v)), bias());
+    }
+    static unsigned less(vector_type a, vector_type b) noexcept {
+        return static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(b, a))));
+    }
+};
+#    endif
+
+template <>
+struct simd_ops<float> {
+    using vector_type                  = __m128;
+    static constexpr std::size_t lanes = 4;
+    static constexpr unsigned    full  = 0xfu;
+
+    static vector_type load(float const* p) noexcept { return _mm_loadu_ps(p); }
+    static vector_type splat(float v) noexcept { return _mm_set1_ps(v); }
+    static unsigned    less(vector_type a, vector_type b) noexcept {
+        return static_cast<unsigned>(_mm_movemask_ps(_mm_cmplt_ps(a, b)));
+    }
+};
+
+template <>
+struct simd_ops<double> {
+    using vector_type                  = __m128d;
+    static constexpr std::size_t lanes = 2;
+    static constexpr unsigned    full  = 0x3u;
+
+    static vector_type load(double const* p) noexcept { return _mm_loadu_pd(p); }
+    static vector_type splat(double v) noexcept { return _mm_set1_pd(v); }
+    static unsigned    less(vector_type a, vector_type b) noexcept {
+        return static_cast<unsigned>(_mm_movemask_pd(_mm_cmplt_pd(a, b)));
+    }
+};
+
+#endif
+
+// Number of the elements in [first, first + n) which precede key, i.e. less than key for
+// lower bound (Strict == true) or not greater than key for upper bound (Strict == false).
+template <bool Strict, typename T>
+std::size_t simd_count_preceding(T const* first, std::size_t n, T key) noexcept {
+    using ops = simd_ops<T>;
+
+    std::size_t count = 0;
+    std::size_t i     = 0;
+    if constexpr (ops::lanes != 0) {
+        auto const k = ops::splat(key);
+        for (; i + ops::lanes <= n; i += ops::lanes) {
+            auto const a = ops::load(first + i);
+            count += __builtin_popcount(Strict ? ops::less(a, k) : ops::full & ~ops::less(k, a));
+        }
+    }
+    for (; i < n; ++i) {
+        count += Strict ? first[i] < key : !(key < first[i]);
+    }
+    return count;
+}
+
+// Returns the offset of lower bound (Strict == true) or upper bound (Strict == false) in
+// [first, first + n).
+// The range is halved without branch until it fits in a cache line, then the rest is counted.
+template <bool Strict, typename T>
+std::size_t simd_bound(T const* first, std::size_t n, T key) noexcept {
+    constexpr std::size_t block = 64 / sizeof(T);
+
+    auto const base = first;
+    while (n > block) {
+        auto const half = n / 2;
+        first += (Strict ? first[half] < key : !(key < first[half])) ? half : 0;
+        n -= half;
+    }
+    return static_cast<std::size_t>(first - base) + simd_count_preceding<Strict>(first, n, key);
+}
+
+}  // namespace flat_map::detail
@@ -61,4 +61,32 @@ struct copy_cv<T, U const volatile> {
 template <typename T, typename U>
 using copy_cv_t = typename copy_cv<T, U>::type;
 
+template <typename T>
+struct is_tied_sequence : public std::false_type {};
+
+template <typename... Sequences>
+struct is_tied_sequence<tied_sequence<Sequences...>> : public std::true_type {};
+
+template <typename T>
+inline constexpr bool is_tied_sequence_v = is_tied_sequence<T>{};
+
+template <typename T>
+struct is_columnar_sequence : public std::false_type {};
+
+template <typename... Ts>
+struct is_columnar_sequence<columnar_sequence<Ts...>> : public std::true_type {};
+
+// Whether T stores each element of tuples in its own column, which is exposed by get_sequence<N>.
+template <typename T>
+inline constexpr bool has_columns_v = is_tied_sequence<T>{} || is_columnar_sequence<T>{};
+
+// std::is_constant_evaluated if available, otherwise always false.
+constexpr bool is_constant_evaluated() noexcept {
+#ifdef __cpp_lib_is_constant_evaluated
+    return std::is_constant_evaluated();
+#else
+    return false;
+#endif
+}
+
 }  // namespace flat_map::detail
@@ -0,0 +1,414 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "flat_map/__flat_tree.hpp"
+#include "flat_map/flat_map.hpp"
+#include "flat_map/flat_multimap.hpp"
+#include "flat_map/flat_set.hpp"
+
+namespace flat_map {
+
+// Flat container which defers insertions and erasures to a small sorted delta log.
+//
+// Inserted elements go to the delta, and erased keys of the main container are recorded as
+// tombstones. Lookups and iteration consult both, and the delta is merged into the main container
+// at once when it grows beyond buffer_limit().
+template <typename Flat>
+class write_buffered {
+   public:
+    using flat_type       = Flat;
+    using key_type        = typename Flat::key_type;
+    using mapped_type     = typename Flat::mapped_type;
+    using value_type      = typename Flat::value_type;
+    using size_type       = typename Flat::size_type;
+    using difference_type = typename Flat::difference_type;
+    using key_compare     = typename Flat::key_compare;
+    using allocator_type  = typename Flat::allocator_type;
+    using reference       = typename Flat::reference;
+    using const_reference = typename Flat::const_reference;
+
+    static constexpr size_type default_buffer_limit = 1024;
+
+   private:
+    static constexpr bool _multi = !std::is_same_v<
+        decltype(std::declval<Flat&>().insert(std::declval<value_type>())),
+        std::pair<typename Flat::iterator, bool>>;
+
+    using _tombstones = flat_set<key_type, key_compare>;
+
+    template <bool Const>
+    class _iterator {
+        friend class write_buffered;
+        template <bool>
+        friend class _iterator;
+
+        using _owner      = std::conditional_t<Const, write_buffered const, write_buffered>;
+        using _flat_itr   = std::
+            conditional_t<Const, typename Flat::const_iterator, typename Flat::iterator>;
+        using _erased_itr = typename _tombstones::const_iterator;
+
+        _owner*     _self = nullptr;
+        _flat_itr   _main;
+        _flat_itr   _delta;
+        _erased_itr _erased;
+
+        _iterator(_owner* self, _flat_itr main, _flat_itr delta, _erased_itr erased)
+            : _self{self}, _main{main}, _delta{delta}, _erased{erased} {
+            _skip_erased();
+        }
+
+        void _skip_erased() {
+            auto const main_end   = _self->_main.end();
+            auto const erased_end = _self->_erased.end();
+            auto const comp       = _self->key_comp();
+            for (; _main != main_end; ++_main) {
+                auto const& key = _key(*_main);
+                while (_erased != erased_end && comp(*_erased, key)) {
+                    ++_erased;
+                }
+                if (_erased == erased_end || comp(key, *_erased)) {
+                    break;
+                }
+            }
+        }
+
+        // Equal elements of the main container precede the ones of the delta.
+        bool _at_main() const {
+            return _main != _self->_main.end()
+                && (_delta == _self->_delta.end()
+                    || !_self->key_comp()(_key(*_delta), _key(*_main)));
+        }
+
+       public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = typename write_buffered::value_type;
+        using difference_type   = typename write_buffered::difference_type;
+        using reference         = typename std::iterator_traits<_flat_itr>::reference;
+        using pointer           = typename std::iterator_traits<_flat_itr>::pointer;
+
+        _iterator() = default;
+
+        template <bool C, typename = std::enable_if_t<Const && !C>>
+        _iterator(_iterator<C> const& other)
+            : _self{other._self},
+              _main{other._main},
+              _delta{other._delta},
+              _erased{other._erased} {}
+
+        reference operator*() const { return _at_main() ? *_main : *_delta; }
+        auto      operator->() const {
+            return _at_main() ? _main.operator->() : _delta.operator->();
+        }
+
+        _iterator& operator++() {
+            if (_at_main()) {
+                ++_main;
+                _skip_erased();
+            } else {
+                ++_delta;
+            }
+            return *this;
+        }
+
+        _iterator operator++(int) {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        friend bool operator==(_iterator const& lhs, _iterator const& rhs) {
+            return lhs._main == rhs._main && lhs._delta == rhs._delta;
+        }
+
+        friend bool operator!=(_iterator const& lhs, _iterator const& rhs) { return !(lhs == rhs); }
+    };
+
+   public:
+    using iterator       = _iterator<false>;
+    using const_iterator = _iterator<true>;
+
+   private:
+    Flat        _main;
+    Flat        _delta;
+    _tombstones _erased;
+    size_type   _hidden = 0;  // number of the elements of _main shadowed by _erased
+    size_type   _limit  = default_buffer_limit;
+
+    template <typename V>
+    static auto& _key(V const& value) {
+        return detail::key_of<key_type>(value);
+    }
+
+    bool _is_erased(key_type const& key) const { return _erased.contains(key); }
+
+    void _reserve_buffer() {
+        if (buffer_size() >= _limit) {
+            flush();
+        }
+    }
+
+    // Element of the delta, which follows the elements of the main container with equal key.
+    iterator _from_delta(typename Flat::iterator itr) {
+        auto const& key = _key(*itr);
+        return {this, _main.upper_bound(key), itr, _erased.upper_bound(key)};
+    }
+
+    template <typename Self>
+    static auto _lower_bound(Self* self, key_type const& key) {
+        using Itr = std::conditional_t<std::is_const_v<Self>, const_iterator, iterator>;
+        return Itr{
+            self,
+            self->_main.lower_bound(key),
+            self->_delta.lower_bound(key),
+            self->_erased.lower_bound(key)
+        };
+    }
+
+    template <typename Self>
+    static auto _upper_bound(Self* self, key_type const& key) {
+        using Itr = std::conditional_t<std::is_const_v<Self>, const_iterator, iterator>;
+        return Itr{
+            self,
+            self->_main.upper_bound(key),
+            self->_delta.upper_bound(key),
+            self->_erased.upper_bound(key)
+        };
+    }
+
+    template <typename Self>
+    static auto _find(Self* self, key_type const& key) {
+        auto itr = _lower_bound(self, key);
+        return itr == self->end() || self->key_comp()(key, _key(*itr)) ? self->end() : itr;
+    }
+
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> _try_emplace(K&& key, Args&&... args) {
+        if (auto itr = find(key); itr != end()) {
+            return {itr, false};
+        }
+        _reserve_buffer();
+        return {_from_delta(_delta.try_emplace(key, std::forward<Args>(args)...).first), true};
+    }
+
+   public:
+    write_buffered() = default;
+
+    explicit write_buffered(Flat&& flat, size_type limit = default_buffer_limit)
+        : _main{std::move(flat)},
+          _delta{_main.key_comp(), _main.get_allocator()},
+          _erased{_main.key_comp()},
+          _limit{limit} {}
+
+    explicit write_buffered(Flat const& flat, size_type limit = default_buffer_limit)
+        : write_buffered{Flat(flat), limit} {}
+
+    // Merges the delta into the main container, and returns it.
+    Flat extract() && {
+        flush();
+        return std::move(_main);
+    }
+
+    allocator_type get_allocator() const noexcept { return _main.get_allocator(); }
+
+    iterator begin() noexcept { return {this, _main.begin(), _delta.begin(), _erased.begin()}; }
+    const_iterator begin() const noexcept {
+        return {this, _main.begin(), _delta.begin(), _erased.begin()};
+    }
+    const_iterator cbegin() const noexcept { return begin(); }
+
+    iterator       end() noexcept { return {this, _main.end(), _delta.end(), _erased.end()}; }
+    const_iterator end() const noexcept { return {this, _main.end(), _delta.end(), _erased.end()}; }
+    const_iterator cend() const noexcept { return end(); }
+
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+    size_type          size() const noexcept { return _main.size() - _hidden + _delta.size(); }
+
+    // Number of the pending insertions and erasures.
+    size_type buffer_size() const noexcept { return _delta.size() + _erased.size(); }
+
+    size_type buffer_limit() const noexcept { return _limit; }
+    void      buffer_limit(size_type limit) {
+        _limit = limit;
+        if (buffer_size() > _limit) {
+            flush();
+        }
+    }
+
+    // Merges the delta into the main container with one linear pass.
+    void flush() {
+        if (buffer_size() == 0) {
+            return;
+        }
+        if (!_erased.empty()) {
+            auto cont   = std::move(_main).extract();
+            auto out    = cont.begin();
+            auto erased = _erased.begin();
+            for (auto in = cont.begin(); in != cont.end(); ++in) {
+                auto const& key = _key(*in);
+                while (erased != _erased.end() && key_comp()(*erased, key)) {
+                    ++erased;
+                }
+                if (erased != _erased.end() && !key_comp()(key, *erased)) {
+                    continue;
+                }
+                if (out != in) {
+                    *out = std::move(*in);
+                }
+                ++out;
+            }
+            cont.erase(out, cont.end());
+            _main.replace(std::move(cont));
+            _erased.clear();
+            _hidden = 0;
+        }
+        // Every key of the delta is absent or erased in _main for the unique container, so that
+        // merge moves all of them.
+        _main.merge(_delta);
+        _delta.clear();
+    }
+
+    void clear() noexcept {
+        _main.clear();
+        _delta.clear();
+        _erased.clear();
+        _hidden = 0;
+    }
+
+    template <bool Multi = _multi, std::enable_if_t<!Multi, std::nullptr_t> = nullptr>
+    std::pair<iterator, bool> insert(value_type const& value) {
+        return _try_emplace(_key(value), std::get<1>(value));
+    }
+
+    template <bool Multi = _multi, std::enable_if_t<!Multi, std::nullptr_t> = nullptr>
+    std::pair<iterator, bool> insert(value_type&& value) {
+        return _try_emplace(_key(value), std::move(std::get<1>(value)));
+    }
+
+    template <bool Multi = _multi, std::enable_if_t<Multi, std::nullptr_t> = nullptr>
+    iterator insert(value_type const& value) {
+        _reserve_buffer();
+        return _from_delta(_delta.insert(value));
+    }
+
+    template <bool Multi = _multi, std::enable_if_t<Multi, std::nullptr_t> = nullptr>
+    iterator insert(value_type&& value) {
+        _reserve_buffer();
+        return _from_delta(_delta.insert(std::move(value)));
+    }
+
+    template <
+        typename... Args,
+        bool Multi                               = _multi,
+        std::enable_if_t<!Multi, std::nullptr_t> = nullptr>
+    std::pair<iterator, bool> try_emplace(key_type const& key, Args&&... args) {
+        return _try_emplace(key, std::forward<Args>(args)...);
+    }
+
+    template <typename M, bool Multi = _multi, std::enable_if_t<!Multi, std::nullptr_t> = nullptr>
+    std::pair<iterator, bool> insert_or_assign(key_type const& key, M&& obj) {
+        if (auto itr = find(key); itr != end()) {
+            std::get<1>(*itr) = std::forward<M>(obj);
+            return {itr, false};
+        }
+        return _try_emplace(key, std::forward<M>(obj));
+    }
+
+    template <bool Multi = _multi, std::enable_if_t<!Multi, std::nullptr_t> = nullptr>
+    mapped_type& operator[](key_type const& key) {
+        return std::get<1>(*_try_emplace(key).first);
+    }
+
+    template <bool Multi = _multi, std::enable_if_t<!Multi, std::nullptr_t> = nullptr>
+    mapped_type& at(key_type const& key) {
+        if (auto itr = find(key); itr != end()) {
+            return std::get<1>(*itr);
+        }
+        throw std::out_of_range("no such key");
+    }
+
+    template <bool Multi = _multi, std::enable_if_t<!Multi, std::nullptr_t> = nullptr>
+    mapped_type const& at(key_type const& key) const {
+        return const_cast<write_buffered*>(this)->at(key);
+    }
+
+    size_type erase(key_type const& key) {
+        auto n = _delta.erase(key);
+        if (!_is_erased(key)) {
+            if (auto const hidden = _main.count(key); hidden != 0) {
+                _reserve_buffer();
+                _erased.insert(key);
+                _hidden += hidden;
+                n += hidden;
+            }
+        }
+        return n;
+    }
+
+    void swap(write_buffered& other) noexcept {
+        using std::swap;
+        swap(_main, other._main);
+        swap(_delta, other._delta);
+        swap(_erased, other._erased);
+        swap(_hidden, other._hidden);
+        swap(_limit, other._limit);
+    }
+
+    size_type count(key_type const& key) const {
+        return _delta.count(key) + (_is_erased(key) ? 0 : _main.count(key));
+    }
+
+    bool contains(key_type const& key) const {
+        return _delta.contains(key) || (!_is_erased(key) && _main.contains(key));
+    }
+
+    iterator       find(key_type const& key) { return _find(this, key); }
+    const_iterator find(key_type const& key) const { return _find(this, key); }
+
+    iterator       lower_bound(key_type const& key) { return _lower_bound(this, key); }
+    const_iterator lower_bound(key_type const& key) const { return _lower_bound(this, key); }
+
+    iterator       upper_bound(key_type const& key) { return _upper_bound(this, key); }
+    const_iterator upper_bound(key_type const& key) const { return _upper_bound(this, key); }
+
+    std::pair<iterator, iterator> equal_range(key_type const& key) {
+        return {lower_bound(key), upper_bound(key)};
+    }
+    std::pair<const_iterator, const_iterator> equal_range(key_type const& key) const {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    key_compare key_comp() const { return _main.key_comp(); }
+};
+
+template <typename Flat>
+void swap(write_buffered<Flat>& lhs, write_buffered<Flat>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+template <
+    typename Key,
+    typename T,
+    typename Compare   = std::less<Key>,
+    typename Container = std::vector<std::pair<Key, T>>>
+using buffered_flat_map = write_buffered<flat_map<Key, T, Compare, Container>>;
+
+template <
+    typename Key,
+    typename T,
+    typename Compare   = std::less<Key>,
+    typename Container = std::vector<std::pair<Key, T>>>
+using buffered_flat_multimap = write_buffered<flat_multimap<Key, T, Compare, Container>>;
+
+}  // namespace flat_map
@@ -0,0 +1,551 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "flat_map/__config.hpp"
+#include "flat_map/__fwd.hpp"
+#include "flat_map/__tuple.hpp"
+#include "flat_map/span_sequence.hpp"
+#include "flat_map/tied_sequence.hpp"
+
+namespace flat_map {
+
+// Sequence of tuples which stores each element of them in its own column like tied_sequence, but
+// all columns are consecutive regions of one allocation. Each region is aligned to a cache line,
+// and all of them are reallocated and relocated at once on growth.
+template <typename... Ts>
+class columnar_sequence {
+    static_assert(sizeof...(Ts) > 0);
+    static_assert(((alignof(Ts) <= 64) && ...), "over-aligned types aren't supported");
+
+    struct alignas(64) _block {
+        unsigned char bytes[64];
+    };
+
+    using _indices_t     = std::index_sequence_for<Ts...>;
+    using _block_alloc_t = typename std::allocator_traits<
+        std::allocator<std::tuple<Ts...>>>::template rebind_alloc<_block>;
+
+   public:
+    using value_type             = std::tuple<Ts...>;
+    using allocator_type         = std::allocator<value_type>;
+    using size_type              = std::size_t;
+    using difference_type        = std::ptrdiff_t;
+    using reference              = detail::tuple<Ts&...>;
+    using const_reference        = detail::tuple<Ts const&...>;
+    using pointer                = detail::tuple<Ts*...>;
+    using const_pointer          = detail::tuple<Ts const*...>;
+    using iterator               = detail::zip_iterator<Ts*...>;
+    using const_iterator         = detail::zip_iterator<Ts const*...>;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+   private:
+    std::tuple<Ts*...> _columns{};
+    size_type          _size     = 0;
+    size_type          _capacity = 0;
+
+    // Number of blocks which hold capacity elements of T.
+    template <typename T>
+    static constexpr size_type _blocks_of(size_type capacity) noexcept {
+        return (capacity * sizeof(T) + sizeof(_block) - 1) / sizeof(_block);
+    }
+
+    // Number of blocks which hold capacity elements of every column.
+    static constexpr size_type _blocks_for(size_type capacity) noexcept {
+        return (_blocks_of<Ts>(capacity) + ...);
+    }
+
+    template <std::size_t... N>
+    static std::tuple<Ts*...> _split(
+        _block* blocks, size_type capacity, std::index_sequence<N...>
+    ) {
+        std::tuple<Ts*...> columns;
+        ((std::get<N>(columns) = reinterpret_cast<Ts*>(blocks), blocks += _blocks_of<Ts>(capacity)),
+         ...);
+        return columns;
+    }
+
+    static std::tuple<Ts*...> _allocate(size_type capacity) {
+        if (capacity == 0) {
+            return {};
+        }
+        _block_alloc_t alloc;
+        return _split(alloc.allocate(_blocks_for(capacity)), capacity, _indices_t{});
+    }
+
+    static void _deallocate(std::tuple<Ts*...> const& columns, size_type capacity) noexcept {
+        if (capacity != 0) {
+            _block_alloc_t alloc;
+            auto const blocks = reinterpret_cast<_block*>(std::get<0>(columns));
+            alloc.deallocate(blocks, _blocks_for(capacity));
+        }
+    }
+
+    template <typename F, std::size_t... N>
+    static void _for_each_column(F&& f, std::index_sequence<N...>) {
+        (f(std::integral_constant<std::size_t, N>{}), ...);
+    }
+
+    // Calls f(column) for each column, where column is an integral_constant of its index.
+    template <typename F>
+    static void _for_each_column(F&& f) {
+        _for_each_column(f, _indices_t{});
+    }
+
+    template <typename T>
+    static void _relocate(T* first, T* last, T* out) {
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+            std::uninitialized_move(first, last, out);
+        } else {
+            std::uninitialized_copy(first, last, out);
+        }
+    }
+
+    // Moves all elements to a new allocation of new_capacity, leaving the gap of n elements at
+    // index, which are constructed by construct(column, pointer to the gap) in advance of moving
+    // the others. If constructing them throws, the sequence is not changed.
+    template <typename Construct>
+    void _reallocate(size_type new_capacity, size_type index, size_type n, Construct construct) {
+        auto      columns     = _allocate(new_capacity);
+        size_type constructed = 0;
+        try {
+            _for_each_column([&](auto column) {
+                auto const dst = std::get<column>(columns);
+                construct(column, dst + index);
+                ++constructed;
+            });
+        } catch (...) {
+            _for_each_column([&](auto column) {
+                if (column < constructed) {
+                    std::destroy_n(std::get<column>(columns) + index, n);
+                }
+            });
+            _deallocate(columns, new_capacity);
+            throw;
+        }
+
+        // Relocations never throw unless moves are replaced with copies which may throw.
+        constructed = 0;
+        try {
+            _for_each_column([&](auto column) {
+                auto const src = std::get<column>(_columns);
+                auto const dst = std::get<column>(columns);
+                _relocate(src, src + index, dst);
+                try {
+                    _relocate(src + index, src + _size, dst + index + n);
+                } catch (...) {
+                    std::destroy_n(dst, index);
+                    throw;
+                }
+                ++constructed;
+            });
+        } catch (...) {
+            _for_each_column([&](auto column) {
+                auto const dst = std::get<column>(columns);
+                if (column < constructed) {
+                    std::destroy_n(dst, _size + n);
+                } else {
+                    std::destroy_n(dst + index, n);
+                }
+            });
+            _deallocate(columns, new_capacity);
+            throw;
+        }
+
+        _destroy_all();
+        _deallocate(_columns, _capacity);
+        _columns  = columns;
+        _capacity = new_capacity;
+        _size += n;
+    }
+
+    void _destroy_all() noexcept {
+        _for_each_column([this](auto column) {
+            std::destroy_n(std::get<column>(_columns), _size);
+        });
+    }
+
+    size_type _grown_capacity(size_type required) const {
+        if (required > max_size()) {
+            throw std::length_error{"columnar_sequence"};
+        }
+        // Every column is padded to whole blocks, so the first allocation fills one of the widest.
+        constexpr size_type least = sizeof(_block) / std::max({sizeof(Ts)...});
+        return std::max({required, least, std::min(max_size(), _capacity * 2)});
+    }
+
+    size_type _index(const_iterator pos) const noexcept {
+        return static_cast<size_type>(pos.template get_iterator<0>() - std::get<0>(_columns));
+    }
+
+    iterator _iterator(size_type index) noexcept { return std::next(begin(), index); }
+
+    // Appends n elements constructed by construct(column, pointer to the tail).
+    template <typename Construct>
+    void _append(size_type n, Construct construct) {
+        if (_size + n > _capacity) {
+            _reallocate(_grown_capacity(_size + n), _size, n, construct);
+            return;
+        }
+        size_type constructed = 0;
+        try {
+            _for_each_column([&](auto column) {
+                construct(column, std::get<column>(_columns) + _size);
+                ++constructed;
+            });
+        } catch (...) {
+            _for_each_column([&](auto column) {
+                if (column < constructed) {
+                    std::destroy_n(std::get<column>(_columns) + _size, n);
+                }
+            });
+            throw;
+        }
+        _size += n;
+    }
+
+    // Moves the elements appended after old_size to index.
+    iterator _rotate_to(size_type index, size_type old_size) {
+        if (index != old_size) {
+            _for_each_column([&](auto column) {
+                auto const data = std::get<column>(_columns);
+                std::rotate(data + index, data + old_size, data + _size);
+            });
+        }
+        return _iterator(index);
+    }
+
+    iterator _insert_one(const_iterator pos, value_type&& value) {
+        auto const index = _index(pos);
+        if (_size == _capacity) {
+            _reallocate(_grown_capacity(_size + 1), index, 1, [&](auto column, auto dst) {
+                ::new (static_cast<void*>(dst))
+                    std::tuple_element_t<column, value_type>(std::get<column>(std::move(value)));
+            });
+            return _iterator(index);
+        }
+        if (index == _size) {
+            _append(1, [&](auto column, auto dst) {
+                ::new (static_cast<void*>(dst))
+                    std::tuple_element_t<column, value_type>(std::get<column>(std::move(value)));
+            });
+            return _iterator(index);
+        }
+
+        // Opens the gap by moving the last element to the tail and the others backward.
+        _append(1, [&](auto column, auto dst) {
+            ::new (static_cast<void*>(dst))
+                std::tuple_element_t<column, value_type>(std::move(*(dst - 1)));
+        });
+        auto const itr = _iterator(index);
+        _for_each_column([&](auto column) {
+            auto const data = std::get<column>(_columns);
+            std::move_backward(data + index, data + _size - 2, data + _size - 1);
+            data[index] = std::get<column>(std::move(value));
+        });
+        return itr;
+    }
+
+    template <typename InputIterator>
+    iterator _insert(
+        const_iterator pos, InputIterator first, InputIterator last, std::input_iterator_tag
+    ) {
+        auto const index    = _index(pos);
+        auto const old_size = _size;
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+        return _rotate_to(index, old_size);
+    }
+
+    template <typename ForwardIterator>
+    iterator _insert(
+        const_iterator pos, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag
+    ) {
+        auto const index    = _index(pos);
+        auto const old_size = _size;
+        auto const n        = static_cast<size_type>(std::distance(first, last));
+        _append(n, [&](auto column, auto dst) {
+            std::uninitialized_copy(
+                detail::unzip<column>(first), detail::unzip<column>(last), dst
+            );
+        });
+        return _rotate_to(index, old_size);
+    }
+
+   public:
+    columnar_sequence() noexcept = default;
+
+    explicit columnar_sequence(allocator_type const&) noexcept {}
+
+    explicit columnar_sequence(size_type count, allocator_type const& alloc = allocator_type())
+        : columnar_sequence(alloc) {
+        resize(count);
+    }
+
+    columnar_sequence(
+        size_type count, value_type const& value, allocator_type const& alloc = allocator_type()
+    )
+        : columnar_sequence(alloc) {
+        resize(count, value);
+    }
+
+    template <typename InputIterator>
+    columnar_sequence(
+        InputIterator first, InputIterator last, allocator_type const& alloc = allocator_type()
+    )
+        : columnar_sequence(alloc) {
+        insert(end(), first, last);
+    }
+
+    columnar_sequence(
+        std::initializer_list<value_type> init, allocator_type const& alloc = allocator_type()
+    )
+        : columnar_sequence(init.begin(), init.end(), alloc) {}
+
+    columnar_sequence(columnar_sequence const& other)
+        : columnar_sequence(other.begin(), other.end()) {}
+
+    columnar_sequence(columnar_sequence const& other, allocator_type const& alloc)
+        : columnar_sequence(other.begin(), other.end(), alloc) {}
+
+    columnar_sequence(columnar_sequence&& other) noexcept
+        : _columns{std::exchange(other._columns, {})},
+          _size{std::exchange(other._size, 0)},
+          _capacity{std::exchange(other._capacity, 0)} {}
+
+    columnar_sequence(columnar_sequence&& other, allocator_type const&) noexcept
+        : columnar_sequence(std::move(other)) {}
+
+    ~columnar_sequence() {
+        _destroy_all();
+        _deallocate(_columns, _capacity);
+    }
+
+    columnar_sequence& operator=(columnar_sequence const& other) {
+        if (this != &other) {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    columnar_sequence& operator=(columnar_sequence&& other) noexcept {
+        columnar_sequence{std::move(other)}.swap(*this);
+        return *this;
+    }
+
+    columnar_sequence& operator=(std::initializer_list<value_type> ilist) {
+        assign(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+    void assign(size_type count, value_type const& value) {
+        clear();
+        resize(count, value);
+    }
+
+    template <typename InputIterator>
+    void assign(InputIterator first, InputIterator last) {
+        clear();
+        insert(end(), first, last);
+    }
+
+    void assign(std::initializer_list<value_type> ilist) { assign(ilist.begin(), ilist.end()); }
+
+    allocator_type get_allocator() const noexcept { return allocator_type(); }
+
+    reference at(size_type pos) {
+        if (!(pos < size())) {
+            throw std::out_of_range{"columnar_sequence::at"};
+        }
+        return operator[](pos);
+    }
+
+    const_reference at(size_type pos) const {
+        return const_cast<columnar_sequence*>(this)->at(pos);
+    }
+
+    reference       operator[](size_type pos) noexcept { return *std::next(begin(), pos); }
+    const_reference operator[](size_type pos) const noexcept { return *std::next(begin(), pos); }
+
+    reference       front() noexcept { return *begin(); }
+    const_reference front() const noexcept { return *begin(); }
+    reference       back() noexcept { return *std::prev(end()); }
+    const_reference back() const noexcept { return *std::prev(end()); }
+
+    iterator       begin() noexcept { return iterator{_columns}; }
+    const_iterator begin() const noexcept { return iterator{_columns}; }
+    const_iterator cbegin() const noexcept { return begin(); }
+    iterator       end() noexcept { return std::next(begin(), _size); }
+    const_iterator end() const noexcept { return std::next(begin(), _size); }
+    const_iterator cend() const noexcept { return end(); }
+
+    reverse_iterator       rbegin() noexcept { return reverse_iterator{end()}; }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator{end()}; }
+    const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+    reverse_iterator       rend() noexcept { return reverse_iterator{begin()}; }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator{begin()}; }
+    const_reverse_iterator crend() const noexcept { return rend(); }
+
+    [[nodiscard]] bool empty() const noexcept { return _size == 0; }
+    size_type          size() const noexcept { return _size; }
+    size_type          max_size() const noexcept {
+        return std::numeric_limits<difference_type>::max() / (sizeof(Ts) + ...);
+    }
+
+    void reserve(size_type new_cap) {
+        if (new_cap > max_size()) {
+            throw std::length_error{"columnar_sequence"};
+        }
+        if (new_cap > _capacity) {
+            _reallocate(new_cap, _size, 0, [](auto, auto) {});
+        }
+    }
+
+    size_type capacity() const noexcept { return _capacity; }
+
+    void shrink_to_fit() {
+        if (_size < _capacity) {
+            _reallocate(_size, _size, 0, [](auto, auto) {});
+        }
+    }
+
+    void clear() noexcept {
+        _destroy_all();
+        _size = 0;
+    }
+
+    iterator insert(const_iterator pos, value_type const& value) {
+        return insert(pos, value_type(value));
+    }
+
+    iterator insert(const_iterator pos, value_type&& value) {
+        return _insert_one(pos, std::move(value));
+    }
+
+    iterator insert(const_iterator pos, size_type count, value_type const& value) {
+        auto const index    = _index(pos);
+        auto const old_size = _size;
+        _append(count, [&](auto column, auto dst) {
+            std::uninitialized_fill_n(dst, count, std::get<column>(value));
+        });
+        return _rotate_to(index, old_size);
+    }
+
+    template <typename InputIterator>
+    iterator insert(const_iterator pos, InputIterator first, InputIterator last) {
+        return _insert(
+            pos,
+            first,
+            last,
+            typename std::iterator_traits<InputIterator>::iterator_category{}
+        );
+    }
+
+    iterator insert(const_iterator pos, std::initializer_list<value_type> ilist) {
+        return insert(pos, ilist.begin(), ilist.end());
+    }
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        return insert(pos, value_type(std::forward<Args>(args)...));
+    }
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, std::piecewise_construct_t, Args&&... args) {
+        static_assert(sizeof...(Args) == sizeof...(Ts));
+        return insert(pos, value_type(std::make_from_tuple<Ts>(std::forward<Args>(args))...));
+    }
+
+    iterator erase(const_iterator pos) { return erase(pos, std::next(pos)); }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        auto const index = _index(first);
+        auto const n     = _index(last) - index;
+        if (n != 0) {
+            _for_each_column([&](auto column) {
+                auto const data = std::get<column>(_columns);
+                std::move(data + index + n, data + _size, data + index);
+                std::destroy_n(data + _size - n, n);
+            });
+            _size -= n;
+        }
+        return _iterator(index);
+    }
+
+    void push_back(value_type const& value) { insert(end(), value); }
+
+    void push_back(value_type&& value) { insert(end(), std::move(value)); }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args) {
+        push_back(value_type(std::forward<Args>(args)...));
+        return back();
+    }
+
+    void pop_back() { erase(std::prev(end())); }
+
+    void resize(size_type count) {
+        if (count < _size) {
+            erase(std::next(begin(), count), end());
+        } else {
+            _append(count - _size, [n = count - _size](auto, auto dst) {
+                std::uninitialized_value_construct_n(dst, n);
+            });
+        }
+    }
+
+    void resize(size_type count, value_type const& value) {
+        if (count < _size) {
+            erase(std::next(begin(), count), end());
+        } else {
+            insert(end(), count - _size, value);
+        }
+    }
+
+    void swap(columnar_sequence& other) noexcept {
+        std::swap(_columns, other._columns);
+        std::swap(_size, other._size);
+        std::swap(_capacity, other._capacity);
+    }
+
+    template <std::size_t N>
+    span_sequence<std::tuple_element_t<N, value_type>> get_sequence() const noexcept {
+        return {std::get<N>(_columns), _size};
+    }
+};
+
+template <std::size_t N, typename... Ts>
+auto get_sequence(columnar_sequence<Ts...> const& seq) noexcept {
+    return seq.template get_sequence<N>();
+}
+
+template <typename... Ts>
+bool operator==(columnar_sequence<Ts...> const& lhs, columnar_sequence<Ts...> const& rhs) {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename... Ts>
+bool operator!=(columnar_sequence<Ts...> const& lhs, columnar_sequence<Ts...> const& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename... Ts>
+void swap(columnar_sequence<Ts...>& lhs, columnar_sequence<Ts...>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+}  // namespace flat_map
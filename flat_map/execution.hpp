@@ -0,0 +1,145 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+namespace flat_map {
+
+// Runs sorting and deduplication of construction and range insertion on multiple threads.
+struct parallel_policy {
+    unsigned concurrency = std::thread::hardware_concurrency();
+};
+
+namespace detail {
+
+// Ranges shorter than this per thread are not worth to spawn a thread.
+inline constexpr std::size_t parallel_grain = 1 << 14;
+
+inline std::size_t parallel_chunks(parallel_policy const& policy, std::size_t n) {
+    auto const limit = std::max<std::size_t>(n / parallel_grain, 1);
+    return std::min<std::size_t>(std::max(policy.concurrency, 1u), limit);
+}
+
+// Calls f(i) for each i in [0, n) on its own thread, except the last one on the calling thread.
+// All of the threads are joined before an exception thrown by f or by spawning a thread is
+// propagated; the first one in the order of i is rethrown if several calls throw.
+template <typename F>
+void parallel_for(std::size_t n, F f) {
+    std::vector<std::exception_ptr> errors(n);
+
+    auto const task = [&f, &errors](std::size_t i) {
+        try {
+            f(i);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    };
+
+    {
+        struct joiner {
+            std::vector<std::thread> threads;
+
+            ~joiner() {
+                for (auto& t : threads) {
+                    t.join();
+                }
+            }
+        } guard;
+        guard.threads.reserve(n - 1);
+        for (std::size_t i = 0; i + 1 < n; ++i) {
+            guard.threads.emplace_back(task, i);
+        }
+        task(n - 1);
+    }
+
+    for (auto const& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+// Same as std::stable_sort, but sorts chunks in parallel and then merges them pairwise.
+template <typename RandomAccessIterator, typename Compare>
+void parallel_stable_sort(
+    parallel_policy const& policy,
+    RandomAccessIterator   first,
+    RandomAccessIterator   last,
+    Compare                comp
+) {
+    auto const n      = static_cast<std::size_t>(std::distance(first, last));
+    auto const chunks = parallel_chunks(policy, n);
+    if (chunks == 1) {
+        std::stable_sort(first, last, comp);
+        return;
+    }
+
+    std::vector<RandomAccessIterator> bounds(chunks + 1);
+    for (std::size_t i = 0; i <= chunks; ++i) {
+        bounds[i] = std::next(first, n * i / chunks);
+    }
+    parallel_for(chunks, [&](std::size_t i) { std::stable_sort(bounds[i], bounds[i + 1], comp); });
+
+    for (std::size_t width = 1; width < chunks; width *= 2) {
+        auto const pairs = (chunks + 2 * width - 1) / (2 * width);
+        parallel_for(pairs, [&](std::size_t i) {
+            auto const lo = 2 * width * i;
+            if (lo + width < chunks) {
+                auto const hi = std::min(lo + 2 * width, chunks);
+                std::inplace_merge(bounds[lo], bounds[lo + width], bounds[hi], comp);
+            }
+        });
+    }
+}
+
+// Same as std::unique on a sorted range, but deduplicates chunks in parallel and then compacts
+// them. The first element of equal ones is kept.
+template <typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator parallel_unique(
+    parallel_policy const& policy, ForwardIterator first, ForwardIterator last, BinaryPredicate eq
+) {
+    auto const n      = static_cast<std::size_t>(std::distance(first, last));
+    auto const chunks = parallel_chunks(policy, n);
+    if (chunks == 1) {
+        return std::unique(first, last, eq);
+    }
+
+    std::vector<ForwardIterator> bounds(chunks + 1);
+    for (std::size_t i = 0; i <= chunks; ++i) {
+        bounds[i] = std::next(first, n * i / chunks);
+    }
+
+    // Skip the leading elements which are equal to the last one of the previous chunk, before
+    // the previous chunk is modified.
+    std::vector<ForwardIterator> heads(bounds.begin(), bounds.end() - 1);
+    parallel_for(chunks, [&](std::size_t i) {
+        if (i != 0) {
+            auto const prev = std::next(first, n * i / chunks - 1);
+            while (heads[i] != bounds[i + 1] && eq(*prev, *heads[i])) {
+                ++heads[i];
+            }
+        }
+    });
+
+    std::vector<ForwardIterator> tails(chunks);
+    parallel_for(chunks, [&](std::size_t i) {
+        tails[i] = std::unique(heads[i], bounds[i + 1], eq);
+    });
+
+    auto out = tails[0];
+    for (std::size_t i = 1; i < chunks; ++i) {
+        out = std::move(heads[i], tails[i], out);
+    }
+    return out;
+}
+
+}  // namespace detail
+
+}  // namespace flat_map
@@ -0,0 +1,191 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "flat_map/__concepts.hpp"
+#include "flat_map/__flat_tree.hpp"
+#include "flat_map/__type_traits.hpp"
+#include "flat_map/enum.hpp"
+
+namespace flat_map {
+
+// Read-only snapshot of a flat container whose elements are stored in Eytzinger (BFS) order.
+template <typename Flat>
+class eytzinger_layout : private detail::comparator_store<typename Flat::key_compare> {
+   public:
+    using flat_type = Flat;
+    using container_type =
+        std::decay_t<decltype(std::declval<Flat const&>().get_container())>;
+    using key_type        = typename Flat::key_type;
+    using value_type      = typename Flat::value_type;
+    using size_type       = typename Flat::size_type;
+    using key_compare     = typename Flat::key_compare;
+    using allocator_type  = typename Flat::allocator_type;
+    using const_reference = typename container_type::const_reference;
+    using const_iterator  = typename container_type::const_iterator;
+
+   private:
+    // Prefetch the node four levels below, whose siblings are laid out contiguously.
+    static constexpr size_type _prefetch_distance = 16;
+
+    static constexpr bool _multi = !std::is_same_v<
+        decltype(std::declval<Flat&>().insert(std::declval<value_type>())),
+        std::pair<typename Flat::iterator, bool>>;
+
+    container_type _container;
+
+    // Walks the implicit tree rooted at k in order; i is the sorted position of the leftmost node.
+    // inverse == true yields the sorted position of each node, otherwise the node of each position.
+    static size_type _number(
+        std::vector<size_type>& perm, size_type k, size_type i, bool inverse
+    ) noexcept {
+        if (k <= perm.size()) {
+            i = _number(perm, 2 * k, i, inverse);
+            if (inverse) {
+                perm[k - 1] = i;
+            } else {
+                perm[i] = k - 1;
+            }
+            i = _number(perm, 2 * k + 1, i + 1, inverse);
+        }
+        return i;
+    }
+
+    template <typename Source>
+    static container_type _permute(Source& source, bool inverse) {
+        std::vector<size_type> perm(source.size());
+        _number(perm, 1, 0, inverse);
+
+        container_type result{source.get_allocator()};
+        if constexpr (concepts::Reservable<container_type>) {
+            result.reserve(perm.size());
+        }
+        auto const first = source.begin();
+        for (auto const i : perm) {
+            result.insert(result.end(), value_type(std::move(first[i])));
+        }
+        return result;
+    }
+
+    template <typename V>
+    static auto& _key(V const& value) {
+        return detail::key_of<key_type>(value);
+    }
+
+    // Returns the BFS position of the result, or size() if every node satisfies pred.
+    template <typename Pred>
+    size_type _search(Pred pred) const {
+        auto const n     = _container.size();
+        auto const first = _container.begin();
+        size_type  k     = 1;
+        while (k <= n) {
+            if constexpr (concepts::HasData<container_type>) {
+                if (k * _prefetch_distance <= n) {
+                    __builtin_prefetch(_container.data() + (k * _prefetch_distance - 1));
+                }
+            }
+            k = 2 * k + pred(first[k - 1]);
+        }
+        k >>= __builtin_ffsll(~k);
+        return k == 0 ? n : k - 1;
+    }
+
+    template <typename K>
+    const_iterator _lower_bound(K const& key) const {
+        auto const pos =
+            _search([&](auto const& value) { return this->_comp()(_key(value), key); });
+        return std::next(_container.begin(), pos);
+    }
+
+    template <typename K>
+    const_iterator _upper_bound(K const& key) const {
+        auto const pos =
+            _search([&](auto const& value) { return !this->_comp()(key, _key(value)); });
+        return std::next(_container.begin(), pos);
+    }
+
+    template <typename K>
+    const_iterator _find(K const& key) const {
+        auto itr = _lower_bound(key);
+        return itr == end() || this->_comp()(key, _key(*itr)) ? end() : itr;
+    }
+
+    template <typename K, typename U>
+    using enable_if_transparent = std::enable_if_t<
+        (sizeof(typename std::enable_if_t<(sizeof(K*) > 0), key_compare>::is_transparent*) > 0),
+        U>;
+
+   public:
+    explicit eytzinger_layout(Flat&& flat)
+        : detail::comparator_store<key_compare>{flat.key_comp()} {
+        auto sorted = std::move(flat).extract();
+        _container  = _permute(sorted, true);
+    }
+
+    explicit eytzinger_layout(Flat const& flat) : eytzinger_layout{Flat(flat)} {}
+
+    eytzinger_layout(eytzinger_layout const&)            = default;
+    eytzinger_layout(eytzinger_layout&&)                 = default;
+    eytzinger_layout& operator=(eytzinger_layout const&) = default;
+    eytzinger_layout& operator=(eytzinger_layout&&)      = default;
+
+    // Restores the sorted order for iteration or mutation.
+    Flat extract() && {
+        auto sorted = _permute(_container, false);
+        _container.clear();
+        auto alloc = sorted.get_allocator();
+        // Elements of a unique container are still unique, so that they aren't deduplicated again.
+        auto const order = _multi ? range_order::sorted : range_order::unique_sorted;
+        return Flat(order, std::move(sorted), this->_comp(), alloc);
+    }
+
+    allocator_type get_allocator() const noexcept { return _container.get_allocator(); }
+
+    // Iterators walk the elements in BFS order, not in key order.
+    const_iterator begin() const noexcept { return _container.begin(); }
+    const_iterator end() const noexcept { return _container.end(); }
+
+    [[nodiscard]] bool empty() const noexcept { return _container.empty(); }
+    size_type          size() const noexcept { return _container.size(); }
+
+    const container_type& get_container() const { return _container; }
+
+    const_iterator find(key_type const& key) const { return _find(key); }
+
+    template <typename K>
+    enable_if_transparent<K, const_iterator> find(K const& key) const {
+        return _find(key);
+    }
+
+    bool contains(key_type const& key) const { return _find(key) != end(); }
+
+    template <typename K>
+    enable_if_transparent<K, bool> contains(K const& key) const {
+        return _find(key) != end();
+    }
+
+    const_iterator lower_bound(key_type const& key) const { return _lower_bound(key); }
+
+    template <typename K>
+    enable_if_transparent<K, const_iterator> lower_bound(K const& key) const {
+        return _lower_bound(key);
+    }
+
+    const_iterator upper_bound(key_type const& key) const { return _upper_bound(key); }
+
+    template <typename K>
+    enable_if_transparent<K, const_iterator> upper_bound(K const& key) const {
+        return _upper_bound(key);
+    }
+
+    key_compare key_comp() const { return this->_comp(); }
+};
+
+}  // namespace flat_map
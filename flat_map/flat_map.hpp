@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <functional>
 #include <initializer_list>
+#include <iterator>
 #include <stdexcept>
 #include <tuple>
 #include <type_traits>
@@ -18,6 +19,8 @@
 #include "flat_map/__fwd.hpp"
 #include "flat_map/__type_traits.hpp"
 #include "flat_map/enum.hpp"
+#include "flat_map/small_vector.hpp"
+#include "flat_map/static_vector.hpp"
 
 namespace flat_map {
 namespace detail {
@@ -48,7 +51,7 @@ struct MappedConstRef<std::tuple<Args...>> {
 // Reference of T.
 template <class T>
 struct ConstCaster {
-    static T& cast(const T& t) {
+    static constexpr T& cast(const T& t) {
         return const_cast<T&>(t);
     }
 };
@@ -56,13 +59,15 @@ struct ConstCaster {
 // For a tuple, reference of each element of a tuple.
 template <class... Args>
 struct ConstCaster<std::tuple<Args...>> {
-    static std::tuple<Args&...> cast(std::tuple<const Args&...>&& t) {
+    static constexpr std::tuple<Args&...> cast(std::tuple<const Args&...>&& t) {
         using indices_t = std::make_index_sequence<sizeof...(Args)>;
         return cast_impl(indices_t{}, std::move(t));
     }
 
     template <std::size_t... N>
-    static std::tuple<Args&...> cast_impl(std::index_sequence<N...>, std::tuple<const Args&...>&& t) {
+    static constexpr std::tuple<Args&...> cast_impl(
+        std::index_sequence<N...>, std::tuple<const Args&...>&& t
+    ) {
         return std::make_tuple(
             std::ref(const_cast<std::tuple_element_t<N, std::tuple<Args&...>>>(std::get<N>(std::move(t))))...);
     }
@@ -105,10 +110,10 @@ class flat_map
        protected:
         Compare c;
 
-        value_compare(Compare c) : c{std::move(c)} {}
+        constexpr value_compare(Compare c) : c{std::move(c)} {}
 
        public:
-        bool operator()(const_reference lhs, const_reference rhs) const {
+        constexpr bool operator()(const_reference lhs, const_reference rhs) const {
             return c(std::get<0>(lhs), std::get<0>(rhs));
         }
     };
@@ -116,36 +121,36 @@ class flat_map
 
    private:
     struct _comparator final : value_compare {
-        _comparator(Compare const& comp) : value_compare{comp} {}
+        constexpr _comparator(Compare const& comp) : value_compare{comp} {}
 
         using value_compare::operator();
 
         template <typename K, typename = std::enable_if_t<!std::is_convertible_v<K, value_type>>>
-        auto operator()(const_reference lhs, K const& rhs) const {
+        constexpr auto operator()(const_reference lhs, K const& rhs) const {
             return this->c(std::get<0>(lhs), rhs);
         }
 
         template <typename K, typename = std::enable_if_t<!std::is_convertible_v<K, value_type>>>
-        auto operator()(K const& lhs, const_reference rhs) const {
+        constexpr auto operator()(K const& lhs, const_reference rhs) const {
             return this->c(lhs, std::get<0>(rhs));
         }
     };
 
     template <typename V>
-    static auto& _key_extractor(V const& value) {
+    static constexpr auto& _key_extractor(V const& value) {
         return std::get<0>(value);
     }
 
    public:
     flat_map() = default;
 
-    explicit flat_map(Compare const& comp, allocator_type const& alloc = allocator_type())
+    constexpr explicit flat_map(Compare const& comp, allocator_type const& alloc = allocator_type())
         : _super{comp, alloc} {}
 
-    explicit flat_map(allocator_type const& alloc) : _super{alloc} {}
+    constexpr explicit flat_map(allocator_type const& alloc) : _super{alloc} {}
 
     template <typename InputIterator>
-    flat_map(
+    constexpr flat_map(
         InputIterator         first,
         InputIterator         last,
         Compare const&        comp  = Compare(),
@@ -156,17 +161,32 @@ class flat_map
     }
 
     template <typename InputIterator>
-    flat_map(InputIterator first, InputIterator last, allocator_type const& alloc) : _super{alloc} {
+    constexpr flat_map(InputIterator first, InputIterator last, allocator_type const& alloc)
+        : _super{alloc} {
         this->_initialize_container(first, last);
     }
 
+    // extension
+    template <typename InputIterator>
+    flat_map(
+        parallel_policy const& policy,
+        InputIterator          first,
+        InputIterator          last,
+        Compare const&         comp  = Compare(),
+        allocator_type const&  alloc = allocator_type()
+    )
+        : _super{comp, alloc} {
+        this->_initialize_container(policy, first, last);
+    }
+
     flat_map(flat_map const& other) = default;
-    flat_map(flat_map const& other, allocator_type const& alloc) : _super{other, alloc} {}
+    constexpr flat_map(flat_map const& other, allocator_type const& alloc) : _super{other, alloc} {}
 
     flat_map(flat_map&& other) = default;
-    flat_map(flat_map&& other, allocator_type const& alloc) : _super{std::move(other), alloc} {}
+    constexpr flat_map(flat_map&& other, allocator_type const& alloc)
+        : _super{std::move(other), alloc} {}
 
-    flat_map(
+    constexpr flat_map(
         std::initializer_list<value_type> init,
         Compare const&                    comp  = Compare(),
         allocator_type const&             alloc = allocator_type()
@@ -175,13 +195,14 @@ class flat_map
         this->_initialize_container(init.begin(), init.end());
     }
 
-    flat_map(std::initializer_list<value_type> init, allocator_type const& alloc) : _super{alloc} {
+    constexpr flat_map(std::initializer_list<value_type> init, allocator_type const& alloc)
+        : _super{alloc} {
         this->_initialize_container(init.begin(), init.end());
     }
 
-    explicit flat_map(range_order order, Container const& cont) : _super{order, cont} {}
+    constexpr explicit flat_map(range_order order, Container const& cont) : _super{order, cont} {}
 
-    explicit flat_map(
+    constexpr explicit flat_map(
         range_order           order,
         Container const&      cont,
         Compare const&        comp,
@@ -192,14 +213,17 @@ class flat_map
              comp
     } {}
 
-    explicit flat_map(range_order order, Container const& cont, allocator_type const& alloc)
+    constexpr explicit flat_map(
+        range_order order, Container const& cont, allocator_type const& alloc
+    )
         : _super{
             order, Container{cont, alloc}
     } {}
 
-    explicit flat_map(range_order order, Container&& cont) : _super{order, std::move(cont)} {}
+    constexpr explicit flat_map(range_order order, Container&& cont)
+        : _super{order, std::move(cont)} {}
 
-    explicit flat_map(
+    constexpr explicit flat_map(
         range_order           order,
         Container&&           cont,
         Compare const&        comp,
@@ -210,11 +234,21 @@ class flat_map
              comp
     } {}
 
-    explicit flat_map(range_order order, Container&& cont, allocator_type const& alloc)
+    constexpr explicit flat_map(range_order order, Container&& cont, allocator_type const& alloc)
         : _super{
             order, Container{std::move(cont), alloc}
     } {}
 
+    // extension
+    explicit flat_map(
+        parallel_policy const& policy,
+        range_order            order,
+        Container&&            cont,
+        Compare const&         comp  = Compare(),
+        allocator_type const&  alloc = allocator_type()
+    )
+        : _super{policy, order, Container{std::move(cont), alloc}, comp} {}
+
     flat_map& operator=(flat_map const& other) = default;
 
     flat_map& operator=(flat_map&& other) noexcept(std::is_nothrow_move_assignable_v<_super>)
@@ -234,22 +268,22 @@ class flat_map
 
     using _super::get_allocator;
 
-    typename detail::MappedConstRef<mapped_type>::type at(key_type const& key) const {
+    constexpr typename detail::MappedConstRef<mapped_type>::type at(key_type const& key) const {
         if (auto [itr, found] = this->_find(key); found) {
             return std::get<1>(*itr);
         }
         throw std::out_of_range("no such key");
     }
 
-    typename detail::MappedRef<mapped_type>::type at(key_type const& key) {
+    constexpr typename detail::MappedRef<mapped_type>::type at(key_type const& key) {
         return detail::ConstCaster<mapped_type>::cast(const_cast<flat_map const*>(this)->at(key));
     }
 
     typename detail::MappedRef<mapped_type>::type operator[](key_type const& key) {
-        return std::get<1>(*try_emplace(key).first);
+        return _subscript(key);
     }
     typename detail::MappedRef<mapped_type>::type operator[](key_type&& key) {
-        return std::get<1>(*try_emplace(std::move(key)).first);
+        return _subscript(std::move(key));
     }
 
     using _super::begin;
@@ -261,19 +295,36 @@ class flat_map
     using _super::rbegin;
     using _super::rend;
 
+    using _super::capacity;
     using _super::clear;
     using _super::empty;
+    using _super::full;
     using _super::max_size;
+    using _super::reserve;
+    using _super::shrink_to_fit;
     using _super::size;
 
     using _super::insert;
 
    private:
+    // A full container refuses a new key, and there is no element to refer to.
+    template <typename K>
+    typename detail::MappedRef<mapped_type>::type _subscript(K&& key) {
+        auto const itr = try_emplace(std::forward<K>(key)).first;
+        if (itr == this->end()) {
+            throw std::length_error("flat_map is full");
+        }
+        return std::get<1>(*itr);
+    }
+
     template <typename K, typename M>
     std::pair<iterator, bool> _insert_or_assign(K&& key, M&& obj) {
         static_assert(std::is_assignable_v<mapped_type&, M&&>);
         auto [itr, found] = this->_find(key);
         if (!found) {
+            if (this->_is_full()) {
+                return {this->end(), false};
+            }
             itr = this->_container.emplace(itr, std::forward<K>(key), std::forward<M>(obj));
         } else {
             std::get<1>(*itr) = std::forward<M>(obj);
@@ -286,6 +337,9 @@ class flat_map
         static_assert(std::is_assignable_v<mapped_type&, M&&>);
         auto [itr, found] = this->_insert_point_uniq(hint, key);
         if (!found) {
+            if (this->_is_full()) {
+                return this->end();
+            }
             itr = this->_container.emplace(itr, std::forward<K>(key), std::forward<M>(obj));
         } else {
             std::get<1>(*itr) = std::forward<M>(obj);
@@ -322,6 +376,9 @@ class flat_map
     std::pair<iterator, bool> _try_emplace(K&& key, Args&&... args) {
         auto [itr, found] = this->_find(key);
         if (!found) {
+            if (this->_is_full()) {
+                return {this->end(), false};
+            }
             itr = this->_container.emplace(
                 itr,
                 std::piecewise_construct,
@@ -336,6 +393,9 @@ class flat_map
     iterator _try_emplace(const_iterator hint, K&& key, Args&&... args) {
         auto [itr, found] = this->_insert_point_uniq(hint, key);
         if (!found) {
+            if (this->_is_full()) {
+                return this->end();
+            }
             itr = this->_container.emplace(
                 itr,
                 std::piecewise_construct,
@@ -421,18 +481,27 @@ class flat_map
         this->_merge(source, std::true_type{});
     }
 
+    // extension
+    template <typename Range>
+    void merge_all(Range&& sources) {
+        this->_merge_all(sources);
+    }
+
     using _super::contains;
+    using _super::contains_many;
     using _super::count;
     using _super::equal_range;
     using _super::find;
+    using _super::find_many;
     using _super::key_comp;
     using _super::lower_bound;
+    using _super::lower_bound_many;
     using _super::upper_bound;
     using _super::value_comp;
 };
 
 template <typename Key, typename T, typename Compare, typename Container>
-bool operator==(
+constexpr bool operator==(
     flat_map<Key, T, Compare, Container> const& lhs, flat_map<Key, T, Compare, Container> const& rhs
 ) {
     return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
@@ -539,4 +608,29 @@ template <
 flat_map(std::initializer_list<std::pair<Key, T>>, Allocator)
     -> flat_map<Key, T, std::less<Key>, std::vector<std::pair<Key, T>, Allocator>>;
 
+// flat_map which holds up to N elements without allocation.
+template <typename Key, typename T, std::size_t N, typename Compare = std::less<Key>>
+using small_flat_map = flat_map<Key, T, Compare, small_vector<std::pair<Key, T>, N>>;
+
+// flat_map which holds up to Capacity elements and never allocates.
+// Inserting a new element into the full map returns end() instead of throwing.
+template <typename Key, typename T, std::size_t Capacity, typename Compare = std::less<Key>>
+using static_flat_map = flat_map<Key, T, Compare, static_vector<std::pair<Key, T>, Capacity>>;
+
+// Builds static_flat_map of the elements of init, which can be a constexpr variable since C++20:
+//
+//     constexpr auto table = make_static_flat_map<int, std::string_view>({{2, "b"}, {1, "a"}});
+//
+// Elements equivalent to a preceding one are dropped as in the constructor of flat_map.
+template <typename Key, typename T, std::size_t N, typename Compare = std::less<Key>>
+constexpr static_flat_map<Key, T, N, Compare> make_static_flat_map(
+    std::pair<Key, T> const (&init)[N], Compare const& comp = Compare()
+) {
+    return static_flat_map<Key, T, N, Compare>(
+        range_order::no_ordered,
+        static_vector<std::pair<Key, T>, N>(std::begin(init), std::end(init)),
+        comp
+    );
+}
+
 }  // namespace flat_map
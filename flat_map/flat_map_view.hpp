@@ -0,0 +1,278 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "flat_map/__flat_tree.hpp"
+#include "flat_map/__fwd.hpp"
+#include "flat_map/enum.hpp"
+#include "flat_map/span_sequence.hpp"
+#include "flat_map/tied_sequence.hpp"
+
+namespace flat_map {
+
+// Read-only flat_map over sorted and unique elements owned by someone else.
+template <
+    typename Key,
+    typename T,
+    typename Compare   = std::less<Key>,
+    typename Container = span_sequence<std::pair<Key, T>>>
+class flat_map_view
+    : private detail::
+          _flat_tree_base<flat_map_view<Key, T, Compare, Container>, Key, Compare, Container> {
+    using _super = typename flat_map_view::_flat_tree_base;
+
+    // To lookup private comparator
+    friend _super;
+
+    static constexpr range_order_t<range_order::unique_sorted> _order{};
+
+   public:
+    using key_type               = typename _super::key_type;
+    using mapped_type            = T;
+    using value_type             = typename _super::value_type;
+    using size_type              = typename _super::size_type;
+    using difference_type        = typename _super::difference_type;
+    using key_compare            = typename _super::key_compare;
+    using reference              = typename _super::reference;
+    using const_reference        = typename _super::const_reference;
+    using pointer                = typename _super::pointer;
+    using const_pointer          = typename _super::const_pointer;
+    using iterator               = typename _super::iterator;
+    using const_iterator         = typename _super::const_iterator;
+    using reverse_iterator       = typename _super::reverse_iterator;
+    using const_reverse_iterator = typename _super::const_reverse_iterator;
+    struct value_compare {
+       protected:
+        Compare c;
+
+        value_compare(Compare c) : c{std::move(c)} {}
+
+       public:
+        bool operator()(const_reference lhs, const_reference rhs) const {
+            return c(std::get<0>(lhs), std::get<0>(rhs));
+        }
+    };
+
+   private:
+    struct _comparator final : value_compare {
+        _comparator(Compare const& comp) : value_compare{comp} {}
+
+        using value_compare::operator();
+
+        template <typename K, typename = std::enable_if_t<!std::is_convertible_v<K, value_type>>>
+        auto operator()(const_reference lhs, K const& rhs) const {
+            return this->c(std::get<0>(lhs), rhs);
+        }
+
+        template <typename K, typename = std::enable_if_t<!std::is_convertible_v<K, value_type>>>
+        auto operator()(K const& lhs, const_reference rhs) const {
+            return this->c(lhs, std::get<0>(rhs));
+        }
+    };
+
+    template <typename V>
+    static auto& _key_extractor(V const& value) {
+        return std::get<0>(value);
+    }
+
+   public:
+    flat_map_view() = default;
+
+    // The elements must be sorted by comp and unique, and must outlive the view.
+    explicit flat_map_view(Container cont, Compare const& comp = Compare())
+        : _super{_order, std::move(cont), comp} {}
+
+    flat_map_view(value_type const* first, size_type count, Compare const& comp = Compare())
+        : flat_map_view{Container{first, count}, comp} {}
+
+    // For the split key/value layout of tied_sequence.
+    flat_map_view(
+        key_type const*    keys,
+        mapped_type const* values,
+        size_type          count,
+        Compare const&     comp = Compare()
+    )
+        : flat_map_view{
+              Container{
+                  span_sequence<key_type>{keys, count}, span_sequence<mapped_type>{values, count}
+              },
+              comp
+    } {}
+
+    using _super::begin;
+    using _super::cbegin;
+    using _super::cend;
+    using _super::crbegin;
+    using _super::crend;
+    using _super::end;
+    using _super::rbegin;
+    using _super::rend;
+
+    using _super::empty;
+    using _super::max_size;
+    using _super::size;
+
+    using _super::get_container;
+
+    mapped_type const& at(key_type const& key) const {
+        if (auto [itr, found] = this->_find(key); found) {
+            return std::get<1>(*itr);
+        }
+        throw std::out_of_range("no such key");
+    }
+
+    using _super::contains;
+    using _super::contains_many;
+    using _super::count;
+    using _super::equal_range;
+    using _super::find;
+    using _super::find_many;
+    using _super::key_comp;
+    using _super::lower_bound;
+    using _super::lower_bound_many;
+    using _super::upper_bound;
+    using _super::value_comp;
+};
+
+// Read-only flat_multimap over sorted elements owned by someone else.
+template <
+    typename Key,
+    typename T,
+    typename Compare   = std::less<Key>,
+    typename Container = span_sequence<std::pair<Key, T>>>
+class flat_multimap_view
+    : private detail::
+          _flat_tree_base<flat_multimap_view<Key, T, Compare, Container>, Key, Compare, Container> {
+    using _super = typename flat_multimap_view::_flat_tree_base;
+
+    // To lookup private comparator
+    friend _super;
+
+    static constexpr range_order_t<range_order::sorted> _order{};
+
+   public:
+    using key_type               = typename _super::key_type;
+    using mapped_type            = T;
+    using value_type             = typename _super::value_type;
+    using size_type              = typename _super::size_type;
+    using difference_type        = typename _super::difference_type;
+    using key_compare            = typename _super::key_compare;
+    using reference              = typename _super::reference;
+    using const_reference        = typename _super::const_reference;
+    using pointer                = typename _super::pointer;
+    using const_pointer          = typename _super::const_pointer;
+    using iterator               = typename _super::iterator;
+    using const_iterator         = typename _super::const_iterator;
+    using reverse_iterator       = typename _super::reverse_iterator;
+    using const_reverse_iterator = typename _super::const_reverse_iterator;
+    struct value_compare {
+       protected:
+        Compare c;
+
+        value_compare(Compare c) : c{std::move(c)} {}
+
+       public:
+        bool operator()(const_reference lhs, const_reference rhs) const {
+            return c(std::get<0>(lhs), std::get<0>(rhs));
+        }
+    };
+
+   private:
+    struct _comparator final : value_compare {
+        _comparator(Compare const& comp) : value_compare{comp} {}
+
+        using value_compare::operator();
+
+        template <typename K, typename = std::enable_if_t<!std::is_convertible_v<K, value_type>>>
+        auto operator()(const_reference lhs, K const& rhs) const {
+            return this->c(std::get<0>(lhs), rhs);
+        }
+
+        template <typename K, typename = std::enable_if_t<!std::is_convertible_v<K, value_type>>>
+        auto operator()(K const& lhs, const_reference rhs) const {
+            return this->c(lhs, std::get<0>(rhs));
+        }
+    };
+
+    template <typename V>
+    static auto& _key_extractor(V const& value) {
+        return std::get<0>(value);
+    }
+
+   public:
+    flat_multimap_view() = default;
+
+    // The elements must be sorted by comp, and must outlive the view.
+    explicit flat_multimap_view(Container cont, Compare const& comp = Compare())
+        : _super{_order, std::move(cont), comp} {}
+
+    flat_multimap_view(value_type const* first, size_type count, Compare const& comp = Compare())
+        : flat_multimap_view{Container{first, count}, comp} {}
+
+    // For the split key/value layout of tied_sequence.
+    flat_multimap_view(
+        key_type const*    keys,
+        mapped_type const* values,
+        size_type          count,
+        Compare const&     comp = Compare()
+    )
+        : flat_multimap_view{
+              Container{
+                  span_sequence<key_type>{keys, count}, span_sequence<mapped_type>{values, count}
+              },
+              comp
+    } {}
+
+    using _super::begin;
+    using _super::cbegin;
+    using _super::cend;
+    using _super::crbegin;
+    using _super::crend;
+    using _super::end;
+    using _super::rbegin;
+    using _super::rend;
+
+    using _super::empty;
+    using _super::max_size;
+    using _super::size;
+
+    using _super::get_container;
+
+    using _super::contains;
+    using _super::contains_many;
+    using _super::count;
+    using _super::equal_range;
+    using _super::find;
+    using _super::find_many;
+    using _super::key_comp;
+    using _super::lower_bound;
+    using _super::lower_bound_many;
+    using _super::upper_bound;
+    using _super::value_comp;
+};
+
+template <typename Key, typename T, typename Compare = std::less<Key>>
+flat_map_view(std::pair<Key, T> const*, std::size_t, Compare = Compare())
+    -> flat_map_view<Key, T, Compare>;
+
+template <typename Key, typename T, typename Compare = std::less<Key>>
+flat_map_view(Key const*, T const*, std::size_t, Compare = Compare())
+    -> flat_map_view<Key, T, Compare, tied_sequence<span_sequence<Key>, span_sequence<T>>>;
+
+template <typename Key, typename T, typename Compare = std::less<Key>>
+flat_multimap_view(std::pair<Key, T> const*, std::size_t, Compare = Compare())
+    -> flat_multimap_view<Key, T, Compare>;
+
+template <typename Key, typename T, typename Compare = std::less<Key>>
+flat_multimap_view(Key const*, T const*, std::size_t, Compare = Compare())
+    -> flat_multimap_view<Key, T, Compare, tied_sequence<span_sequence<Key>, span_sequence<T>>>;
+
+}  // namespace flat_map
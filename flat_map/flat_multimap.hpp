@@ -16,6 +16,8 @@
 #include "flat_map/__fwd.hpp"
 #include "flat_map/__type_traits.hpp"
 #include "flat_map/enum.hpp"
+#include "flat_map/small_vector.hpp"
+#include "flat_map/static_vector.hpp"
 
 namespace flat_map {
 
@@ -110,6 +112,19 @@ class flat_multimap
         this->_initialize_container(first, last);
     }
 
+    // extension
+    template <typename InputIterator>
+    flat_multimap(
+        parallel_policy const& policy,
+        InputIterator          first,
+        InputIterator          last,
+        Compare const&         comp  = Compare(),
+        allocator_type const&  alloc = allocator_type()
+    )
+        : _super{comp, alloc} {
+        this->_initialize_container(policy, first, last);
+    }
+
     flat_multimap(flat_multimap const& other) = default;
     flat_multimap(flat_multimap const& other, allocator_type const& alloc) : _super{other, alloc} {}
 
@@ -167,6 +182,16 @@ class flat_multimap
             order, Container{std::move(cont), alloc}
     } {}
 
+    // extension
+    explicit flat_multimap(
+        parallel_policy const& policy,
+        range_order            order,
+        Container&&            cont,
+        Compare const&         comp  = Compare(),
+        allocator_type const&  alloc = allocator_type()
+    )
+        : _super{policy, order, Container{std::move(cont), alloc}, comp} {}
+
     flat_multimap& operator=(flat_multimap const& other) = default;
 
     flat_multimap& operator=(flat_multimap&& other
@@ -196,9 +221,13 @@ class flat_multimap
     using _super::rbegin;
     using _super::rend;
 
+    using _super::capacity;
     using _super::clear;
     using _super::empty;
+    using _super::full;
     using _super::max_size;
+    using _super::reserve;
+    using _super::shrink_to_fit;
     using _super::size;
 
     using _super::emplace;
@@ -259,12 +288,21 @@ class flat_multimap
         this->_merge(source, std::true_type{});
     }
 
+    // extension
+    template <typename Range>
+    void merge_all(Range&& sources) {
+        this->_merge_all(sources);
+    }
+
     using _super::contains;
+    using _super::contains_many;
     using _super::count;
     using _super::equal_range;
     using _super::find;
+    using _super::find_many;
     using _super::key_comp;
     using _super::lower_bound;
+    using _super::lower_bound_many;
     using _super::upper_bound;
     using _super::value_comp;
 };
@@ -386,4 +424,14 @@ template <
 flat_multimap(std::initializer_list<std::pair<Key, T>>, Allocator)
     -> flat_multimap<Key, T, std::less<Key>, std::vector<std::pair<Key, T>, Allocator>>;
 
+// flat_multimap which holds up to N elements without allocation.
+template <typename Key, typename T, std::size_t N, typename Compare = std::less<Key>>
+using small_flat_multimap = flat_multimap<Key, T, Compare, small_vector<std::pair<Key, T>, N>>;
+
+// flat_multimap which holds up to Capacity elements and never allocates.
+// Inserting into the full map returns end() instead of throwing.
+template <typename Key, typename T, std::size_t Capacity, typename Compare = std::less<Key>>
+using static_flat_multimap =
+    flat_multimap<Key, T, Compare, static_vector<std::pair<Key, T>, Capacity>>;
+
 }  // namespace flat_map
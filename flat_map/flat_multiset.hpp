@@ -16,6 +16,8 @@
 #include "flat_map/__fwd.hpp"
 #include "flat_map/__type_traits.hpp"
 #include "flat_map/enum.hpp"
+#include "flat_map/small_vector.hpp"
+#include "flat_map/static_vector.hpp"
 
 namespace flat_map {
 
@@ -81,6 +83,19 @@ class flat_multiset
         this->_initialize_container(first, last);
     }
 
+    // extension
+    template <typename InputIterator>
+    flat_multiset(
+        parallel_policy const& policy,
+        InputIterator          first,
+        InputIterator          last,
+        Compare const&         comp  = Compare(),
+        allocator_type const&  alloc = allocator_type()
+    )
+        : _super{comp, alloc} {
+        this->_initialize_container(policy, first, last);
+    }
+
     flat_multiset(flat_multiset const& other) = default;
     flat_multiset(flat_multiset const& other, allocator_type const& alloc) : _super{other, alloc} {}
 
@@ -138,6 +153,16 @@ class flat_multiset
             order, Container{std::move(cont), alloc}
     } {}
 
+    // extension
+    explicit flat_multiset(
+        parallel_policy const& policy,
+        range_order            order,
+        Container&&            cont,
+        Compare const&         comp  = Compare(),
+        allocator_type const&  alloc = allocator_type()
+    )
+        : _super{policy, order, Container{std::move(cont), alloc}, comp} {}
+
     flat_multiset& operator=(flat_multiset const& other) = default;
 
     flat_multiset& operator=(flat_multiset&& other
@@ -167,9 +192,13 @@ class flat_multiset
     using _super::rbegin;
     using _super::rend;
 
+    using _super::capacity;
     using _super::clear;
     using _super::empty;
+    using _super::full;
     using _super::max_size;
+    using _super::reserve;
+    using _super::shrink_to_fit;
     using _super::size;
 
     using _super::emplace;
@@ -230,12 +259,21 @@ class flat_multiset
         this->_merge(source, std::true_type{});
     }
 
+    // extension
+    template <typename Range>
+    void merge_all(Range&& sources) {
+        this->_merge_all(sources);
+    }
+
     using _super::contains;
+    using _super::contains_many;
     using _super::count;
     using _super::equal_range;
     using _super::find;
+    using _super::find_many;
     using _super::key_comp;
     using _super::lower_bound;
+    using _super::lower_bound_many;
     using _super::upper_bound;
     using _super::value_comp;
 };
@@ -349,4 +387,13 @@ template <
 flat_multiset(std::initializer_list<Key>, Allocator)
     -> flat_multiset<Key, std::less<Key>, std::vector<Key, Allocator>>;
 
+// flat_multiset which holds up to N elements without allocation.
+template <typename Key, std::size_t N, typename Compare = std::less<Key>>
+using small_flat_multiset = flat_multiset<Key, Compare, small_vector<Key, N>>;
+
+// flat_multiset which holds up to Capacity elements and never allocates.
+// Inserting into the full set returns end() instead of throwing.
+template <typename Key, std::size_t Capacity, typename Compare = std::less<Key>>
+using static_flat_multiset = flat_multiset<Key, Compare, static_vector<Key, Capacity>>;
+
 }  // namespace flat_map
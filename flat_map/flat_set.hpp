@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <functional>
 #include <initializer_list>
+#include <iterator>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -16,6 +17,8 @@
 #include "flat_map/__fwd.hpp"
 #include "flat_map/__type_traits.hpp"
 #include "flat_map/enum.hpp"
+#include "flat_map/small_vector.hpp"
+#include "flat_map/static_vector.hpp"
 
 namespace flat_map {
 
@@ -52,20 +55,20 @@ class flat_set
     using _comparator = value_compare;
 
     template <typename V>
-    static auto& _key_extractor(V const& value) {
+    static constexpr auto& _key_extractor(V const& value) {
         return value;
     }
 
    public:
     flat_set() = default;
 
-    explicit flat_set(Compare const& comp, allocator_type const& alloc = allocator_type())
+    constexpr explicit flat_set(Compare const& comp, allocator_type const& alloc = allocator_type())
         : _super{comp, alloc} {}
 
-    explicit flat_set(allocator_type const& alloc) : _super{alloc} {}
+    constexpr explicit flat_set(allocator_type const& alloc) : _super{alloc} {}
 
     template <typename InputIterator>
-    flat_set(
+    constexpr flat_set(
         InputIterator         first,
         InputIterator         last,
         Compare const&        comp  = Compare(),
@@ -76,17 +79,32 @@ class flat_set
     }
 
     template <typename InputIterator>
-    flat_set(InputIterator first, InputIterator last, allocator_type const& alloc) : _super{alloc} {
+    constexpr flat_set(InputIterator first, InputIterator last, allocator_type const& alloc)
+        : _super{alloc} {
         this->_initialize_container(first, last);
     }
 
+    // extension
+    template <typename InputIterator>
+    flat_set(
+        parallel_policy const& policy,
+        InputIterator          first,
+        InputIterator          last,
+        Compare const&         comp  = Compare(),
+        allocator_type const&  alloc = allocator_type()
+    )
+        : _super{comp, alloc} {
+        this->_initialize_container(policy, first, last);
+    }
+
     flat_set(flat_set const& other) = default;
-    flat_set(flat_set const& other, allocator_type const& alloc) : _super{other, alloc} {}
+    constexpr flat_set(flat_set const& other, allocator_type const& alloc) : _super{other, alloc} {}
 
     flat_set(flat_set&& other) = default;
-    flat_set(flat_set&& other, allocator_type const& alloc) : _super{std::move(other), alloc} {}
+    constexpr flat_set(flat_set&& other, allocator_type const& alloc)
+        : _super{std::move(other), alloc} {}
 
-    flat_set(
+    constexpr flat_set(
         std::initializer_list<value_type> init,
         Compare const&                    comp  = Compare(),
         allocator_type const&             alloc = allocator_type()
@@ -95,13 +113,14 @@ class flat_set
         this->_initialize_container(init.begin(), init.end());
     }
 
-    flat_set(std::initializer_list<value_type> init, allocator_type const& alloc) : _super{alloc} {
+    constexpr flat_set(std::initializer_list<value_type> init, allocator_type const& alloc)
+        : _super{alloc} {
         this->_initialize_container(init.begin(), init.end());
     }
 
-    explicit flat_set(range_order order, Container const& cont) : _super{order, cont} {}
+    constexpr explicit flat_set(range_order order, Container const& cont) : _super{order, cont} {}
 
-    explicit flat_set(
+    constexpr explicit flat_set(
         range_order           order,
         Container const&      cont,
         Compare const&        comp,
@@ -112,14 +131,17 @@ class flat_set
              comp
     } {}
 
-    explicit flat_set(range_order order, Container const& cont, allocator_type const& alloc)
+    constexpr explicit flat_set(
+        range_order order, Container const& cont, allocator_type const& alloc
+    )
         : _super{
             order, Container{cont, alloc}
     } {}
 
-    explicit flat_set(range_order order, Container&& cont) : _super{order, std::move(cont)} {}
+    constexpr explicit flat_set(range_order order, Container&& cont)
+        : _super{order, std::move(cont)} {}
 
-    explicit flat_set(
+    constexpr explicit flat_set(
         range_order           order,
         Container&&           cont,
         Compare const&        comp,
@@ -130,11 +152,21 @@ class flat_set
              comp
     } {}
 
-    explicit flat_set(range_order order, Container&& cont, allocator_type const& alloc)
+    constexpr explicit flat_set(range_order order, Container&& cont, allocator_type const& alloc)
         : _super{
             order, Container{std::move(cont), alloc}
     } {}
 
+    // extension
+    explicit flat_set(
+        parallel_policy const& policy,
+        range_order            order,
+        Container&&            cont,
+        Compare const&         comp  = Compare(),
+        allocator_type const&  alloc = allocator_type()
+    )
+        : _super{policy, order, Container{std::move(cont), alloc}, comp} {}
+
     flat_set& operator=(flat_set const& other) = default;
 
     flat_set& operator=(flat_set&& other) noexcept(std::is_nothrow_move_assignable_v<_super>)
@@ -163,9 +195,13 @@ class flat_set
     using _super::rbegin;
     using _super::rend;
 
+    using _super::capacity;
     using _super::clear;
     using _super::empty;
+    using _super::full;
     using _super::max_size;
+    using _super::reserve;
+    using _super::shrink_to_fit;
     using _super::size;
 
     using _super::emplace;
@@ -226,18 +262,27 @@ class flat_set
         this->_merge(source, std::true_type{});
     }
 
+    // extension
+    template <typename Range>
+    void merge_all(Range&& sources) {
+        this->_merge_all(sources);
+    }
+
     using _super::contains;
+    using _super::contains_many;
     using _super::count;
     using _super::equal_range;
     using _super::find;
+    using _super::find_many;
     using _super::key_comp;
     using _super::lower_bound;
+    using _super::lower_bound_many;
     using _super::upper_bound;
     using _super::value_comp;
 };
 
 template <typename Key, typename Compare, typename Container>
-bool operator==(
+constexpr bool operator==(
     flat_set<Key, Compare, Container> const& lhs, flat_set<Key, Compare, Container> const& rhs
 ) {
     return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
@@ -338,4 +383,23 @@ template <
 flat_set(std::initializer_list<Key>, Allocator)
     -> flat_set<Key, std::less<Key>, std::vector<Key, Allocator>>;
 
+// flat_set which holds up to N elements without allocation.
+template <typename Key, std::size_t N, typename Compare = std::less<Key>>
+using small_flat_set = flat_set<Key, Compare, small_vector<Key, N>>;
+
+// flat_set which holds up to Capacity elements and never allocates.
+// Inserting a new element into the full set returns end() instead of throwing.
+template <typename Key, std::size_t Capacity, typename Compare = std::less<Key>>
+using static_flat_set = flat_set<Key, Compare, static_vector<Key, Capacity>>;
+
+// Builds static_flat_set of the elements of init, which can be a constexpr variable since C++20.
+template <typename Key, std::size_t N, typename Compare = std::less<Key>>
+constexpr static_flat_set<Key, N, Compare> make_static_flat_set(
+    Key const (&init)[N], Compare const& comp = Compare()
+) {
+    return static_flat_set<Key, N, Compare>(
+        range_order::no_ordered, static_vector<Key, N>(std::begin(init), std::end(init)), comp
+    );
+}
+
 }  // namespace flat_map
@@ -0,0 +1,171 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+#include "flat_map/__flat_tree.hpp"
+#include "flat_map/enum.hpp"
+#include "flat_map/span_sequence.hpp"
+
+namespace flat_map {
+
+// Read-only flat_set over sorted and unique keys owned by someone else.
+template <typename Key, typename Compare = std::less<Key>, typename Container = span_sequence<Key>>
+class flat_set_view
+    : private detail::
+          _flat_tree_base<flat_set_view<Key, Compare, Container>, Key, Compare, Container> {
+    using _super = typename flat_set_view::_flat_tree_base;
+
+    // To lookup private comparator
+    friend _super;
+
+    static constexpr range_order_t<range_order::unique_sorted> _order{};
+
+   public:
+    using key_type               = typename _super::key_type;
+    using value_type             = typename _super::value_type;
+    using size_type              = typename _super::size_type;
+    using difference_type        = typename _super::difference_type;
+    using key_compare            = typename _super::key_compare;
+    using value_compare          = key_compare;
+    using reference              = typename _super::reference;
+    using const_reference        = typename _super::const_reference;
+    using pointer                = typename _super::pointer;
+    using const_pointer          = typename _super::const_pointer;
+    using iterator               = typename _super::iterator;
+    using const_iterator         = typename _super::const_iterator;
+    using reverse_iterator       = typename _super::reverse_iterator;
+    using const_reverse_iterator = typename _super::const_reverse_iterator;
+
+   private:
+    using _comparator = value_compare;
+
+    template <typename V>
+    static auto& _key_extractor(V const& value) {
+        return value;
+    }
+
+   public:
+    flat_set_view() = default;
+
+    // The keys must be sorted by comp and unique, and must outlive the view.
+    explicit flat_set_view(Container cont, Compare const& comp = Compare())
+        : _super{_order, std::move(cont), comp} {}
+
+    flat_set_view(value_type const* first, size_type count, Compare const& comp = Compare())
+        : flat_set_view{Container{first, count}, comp} {}
+
+    using _super::begin;
+    using _super::cbegin;
+    using _super::cend;
+    using _super::crbegin;
+    using _super::crend;
+    using _super::end;
+    using _super::rbegin;
+    using _super::rend;
+
+    using _super::empty;
+    using _super::max_size;
+    using _super::size;
+
+    using _super::get_container;
+
+    using _super::contains;
+    using _super::contains_many;
+    using _super::count;
+    using _super::equal_range;
+    using _super::find;
+    using _super::find_many;
+    using _super::key_comp;
+    using _super::lower_bound;
+    using _super::lower_bound_many;
+    using _super::upper_bound;
+    using _super::value_comp;
+};
+
+// Read-only flat_multiset over sorted keys owned by someone else.
+template <typename Key, typename Compare = std::less<Key>, typename Container = span_sequence<Key>>
+class flat_multiset_view
+    : private detail::
+          _flat_tree_base<flat_multiset_view<Key, Compare, Container>, Key, Compare, Container> {
+    using _super = typename flat_multiset_view::_flat_tree_base;
+
+    // To lookup private comparator
+    friend _super;
+
+    static constexpr range_order_t<range_order::sorted> _order{};
+
+   public:
+    using key_type               = typename _super::key_type;
+    using value_type             = typename _super::value_type;
+    using size_type              = typename _super::size_type;
+    using difference_type        = typename _super::difference_type;
+    using key_compare            = typename _super::key_compare;
+    using value_compare          = key_compare;
+    using reference              = typename _super::reference;
+    using const_reference        = typename _super::const_reference;
+    using pointer                = typename _super::pointer;
+    using const_pointer          = typename _super::const_pointer;
+    using iterator               = typename _super::iterator;
+    using const_iterator         = typename _super::const_iterator;
+    using reverse_iterator       = typename _super::reverse_iterator;
+    using const_reverse_iterator = typename _super::const_reverse_iterator;
+
+   private:
+    using _comparator = value_compare;
+
+    template <typename V>
+    static auto& _key_extractor(V const& value) {
+        return value;
+    }
+
+   public:
+    flat_multiset_view() = default;
+
+    // The keys must be sorted by comp, and must outlive the view.
+    explicit flat_multiset_view(Container cont, Compare const& comp = Compare())
+        : _super{_order, std::move(cont), comp} {}
+
+    flat_multiset_view(value_type const* first, size_type count, Compare const& comp = Compare())
+        : flat_multiset_view{Container{first, count}, comp} {}
+
+    using _super::begin;
+    using _super::cbegin;
+    using _super::cend;
+    using _super::crbegin;
+    using _super::crend;
+    using _super::end;
+    using _super::rbegin;
+    using _super::rend;
+
+    using _super::empty;
+    using _super::max_size;
+    using _super::size;
+
+    using _super::get_container;
+
+    using _super::contains;
+    using _super::contains_many;
+    using _super::count;
+    using _super::equal_range;
+    using _super::find;
+    using _super::find_many;
+    using _super::key_comp;
+    using _super::lower_bound;
+    using _super::lower_bound_many;
+    using _super::upper_bound;
+    using _super::value_comp;
+};
+
+template <typename Key, typename Compare = std::less<Key>>
+flat_set_view(Key const*, std::size_t, Compare = Compare()) -> flat_set_view<Key, Compare>;
+
+template <typename Key, typename Compare = std::less<Key>>
+flat_multiset_view(Key const*, std::size_t, Compare = Compare())
+    -> flat_multiset_view<Key, Compare>;
+
+}  // namespace flat_map
@@ -0,0 +1,258 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "flat_map/__flat_tree.hpp"
+
+namespace flat_map {
+
+namespace detail {
+
+// Finalizer of MurmurHash3, which spreads every bit of x over the result.
+constexpr std::uint64_t mix_hash(std::uint64_t x) noexcept {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+// Maps x onto [0, n) by the high bits instead of modulo, which costs a division.
+constexpr std::size_t reduce_hash(std::uint64_t x, std::size_t n) noexcept {
+    if (n <= std::numeric_limits<std::uint32_t>::max()) {
+        return std::size_t(((x >> 32) * std::uint64_t(n)) >> 32);
+    }
+    return std::size_t(x % n);
+}
+
+}  // namespace detail
+
+// Read-only snapshot of a flat container which finds a key with a single probe of a minimal
+// perfect hash, while keeping the elements sorted for iteration and range queries.
+// The hash is built by hash and displace: keys are grouped into buckets by their hash, and each
+// bucket, from the largest one, is given the first seed which sends all of its keys to free slots.
+template <
+    typename Flat,
+    typename Hash     = std::hash<typename Flat::key_type>,
+    typename KeyEqual = std::equal_to<typename Flat::key_type>>
+class frozen_flat_map {
+   public:
+    using flat_type              = Flat;
+    using key_type               = typename Flat::key_type;
+    using value_type             = typename Flat::value_type;
+    using size_type              = typename Flat::size_type;
+    using key_compare            = typename Flat::key_compare;
+    using hasher                 = Hash;
+    using key_equal              = KeyEqual;
+    using allocator_type         = typename Flat::allocator_type;
+    using const_reference        = typename Flat::const_reference;
+    using const_iterator         = typename Flat::const_iterator;
+    using const_reverse_iterator = typename Flat::const_reverse_iterator;
+
+   private:
+    // Seed of a bucket whose keys are found by binary search, as some of them have the same hash.
+    static constexpr std::uint32_t _fallback = std::numeric_limits<std::uint32_t>::max();
+
+    Flat                       _flat;
+    Hash                       _hash;
+    KeyEqual                   _key_eq;
+    std::vector<std::uint32_t> _seeds;
+    // Sorted position of the key in each slot, or size() if the slot is empty.
+    std::vector<size_type> _slots;
+
+    template <typename V>
+    static auto& _key(V const& value) {
+        return detail::key_of<key_type>(value);
+    }
+
+    template <typename K>
+    std::uint64_t _hash_of(K const& key) const {
+        return detail::mix_hash(static_cast<std::uint64_t>(_hash(key)));
+    }
+
+    static size_type _slot_of(std::uint64_t hash, std::uint32_t seed, size_type n) noexcept {
+        return detail::reduce_hash(detail::mix_hash(hash + seed * 0x9e3779b97f4a7c15ULL), n);
+    }
+
+    void _build() {
+        auto const n     = _flat.size();
+        auto const first = _flat.begin();
+        _seeds.assign(n / 2 + 1, 0);
+        _slots.assign(n, n);
+
+        // Hash and position of each key, where only the first one of equivalent keys is kept.
+        std::vector<std::pair<std::uint64_t, size_type>> entries;
+        entries.reserve(n);
+        for (size_type i = 0; i < n; ++i) {
+            if (i == 0 || !_key_eq(_key(first[i - 1]), _key(first[i]))) {
+                entries.emplace_back(_hash_of(_key(first[i])), i);
+            }
+        }
+        auto const bucket_of = [nb = _seeds.size()](auto const& entry) {
+            return detail::reduce_hash(entry.first, nb);
+        };
+        std::sort(entries.begin(), entries.end(), [&](auto const& lhs, auto const& rhs) {
+            return std::pair{bucket_of(lhs), lhs.first} < std::pair{bucket_of(rhs), rhs.first};
+        });
+
+        std::vector<std::pair<size_type, size_type>> buckets;
+        for (size_type i = 0; i < entries.size();) {
+            auto j = i + 1;
+            while (j < entries.size() && bucket_of(entries[j]) == bucket_of(entries[i])) {
+                ++j;
+            }
+            buckets.emplace_back(i, j);
+            i = j;
+        }
+        std::stable_sort(buckets.begin(), buckets.end(), [](auto const& lhs, auto const& rhs) {
+            return lhs.second - lhs.first > rhs.second - rhs.first;
+        });
+
+        std::vector<size_type> taken;
+        for (auto const& [lo, hi] : buckets) {
+            auto const b = bucket_of(entries[lo]);
+            for (auto i = lo + 1; i < hi; ++i) {
+                if (entries[i - 1].first == entries[i].first) {
+                    _seeds[b] = _fallback;
+                }
+            }
+            for (; _seeds[b] != _fallback; ++_seeds[b]) {
+                taken.clear();
+                for (auto i = lo; i < hi; ++i) {
+                    auto const slot = _slot_of(entries[i].first, _seeds[b], n);
+                    if (_slots[slot] != n
+                        || std::find(taken.begin(), taken.end(), slot) != taken.end()) {
+                        break;
+                    }
+                    taken.push_back(slot);
+                }
+                if (taken.size() == hi - lo) {
+                    for (size_type i = 0; i < taken.size(); ++i) {
+                        _slots[taken[i]] = entries[lo + i].second;
+                    }
+                    break;
+                }
+            }
+        }
+    }
+
+    template <typename K>
+    const_iterator _find(K const& key) const {
+        if (_slots.empty()) {
+            return end();
+        }
+        auto const hash = _hash_of(key);
+        auto const seed = _seeds[detail::reduce_hash(hash, _seeds.size())];
+        if (seed == _fallback) {
+            return _flat.find(key);
+        }
+        auto const pos = _slots[_slot_of(hash, seed, _slots.size())];
+        if (pos == _slots.size()) {
+            return end();
+        }
+        auto const itr = std::next(begin(), pos);
+        return _key_eq(key, _key(*itr)) ? itr : end();
+    }
+
+    template <typename K, typename T>
+    using transparent_t = typename std::enable_if_t<(sizeof(K*) > 0), T>::is_transparent;
+
+    template <typename K, typename U>
+    using enable_if_transparent = std::enable_if_t<
+        (sizeof(transparent_t<K, Hash>*) > 0) && (sizeof(transparent_t<K, KeyEqual>*) > 0),
+        U>;
+
+   public:
+    explicit frozen_flat_map(
+        Flat&& flat, Hash const& hash = Hash(), KeyEqual const& key_eq = KeyEqual()
+    )
+        : _flat{std::move(flat)}, _hash{hash}, _key_eq{key_eq} {
+        _build();
+    }
+
+    explicit frozen_flat_map(
+        Flat const& flat, Hash const& hash = Hash(), KeyEqual const& key_eq = KeyEqual()
+    )
+        : frozen_flat_map{Flat(flat), hash, key_eq} {}
+
+    frozen_flat_map(frozen_flat_map const&)            = default;
+    frozen_flat_map(frozen_flat_map&&)                 = default;
+    frozen_flat_map& operator=(frozen_flat_map const&) = default;
+    frozen_flat_map& operator=(frozen_flat_map&&)      = default;
+
+    // Drops the hash and returns the elements for mutation.
+    Flat extract() && {
+        auto flat = std::move(_flat);
+        _flat.clear();
+        _seeds.clear();
+        _slots.clear();
+        return flat;
+    }
+
+    allocator_type get_allocator() const noexcept { return _flat.get_allocator(); }
+
+    const_iterator         begin() const noexcept { return _flat.begin(); }
+    const_iterator         end() const noexcept { return _flat.end(); }
+    const_iterator         cbegin() const noexcept { return _flat.cbegin(); }
+    const_iterator         cend() const noexcept { return _flat.cend(); }
+    const_reverse_iterator rbegin() const noexcept { return _flat.rbegin(); }
+    const_reverse_iterator rend() const noexcept { return _flat.rend(); }
+
+    [[nodiscard]] bool empty() const noexcept { return _flat.empty(); }
+    size_type          size() const noexcept { return _flat.size(); }
+
+    const_iterator find(key_type const& key) const { return _find(key); }
+
+    template <typename K>
+    enable_if_transparent<K, const_iterator> find(K const& key) const {
+        return _find(key);
+    }
+
+    bool contains(key_type const& key) const { return _find(key) != end(); }
+
+    template <typename K>
+    enable_if_transparent<K, bool> contains(K const& key) const {
+        return _find(key) != end();
+    }
+
+    // Range queries are answered by binary search on the sorted elements.
+    template <typename K>
+    auto count(K const& key) const -> decltype(_flat.count(key)) {
+        return _flat.count(key);
+    }
+
+    template <typename K>
+    auto equal_range(K const& key) const -> decltype(_flat.equal_range(key)) {
+        return _flat.equal_range(key);
+    }
+
+    template <typename K>
+    auto lower_bound(K const& key) const -> decltype(_flat.lower_bound(key)) {
+        return _flat.lower_bound(key);
+    }
+
+    template <typename K>
+    auto upper_bound(K const& key) const -> decltype(_flat.upper_bound(key)) {
+        return _flat.upper_bound(key);
+    }
+
+    key_compare key_comp() const { return _flat.key_comp(); }
+    hasher      hash_function() const { return _hash; }
+    key_equal   key_eq() const { return _key_eq; }
+
+    decltype(auto) get_container() const { return _flat.get_container(); }
+};
+
+}  // namespace flat_map
@@ -0,0 +1,254 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "flat_map/__flat_tree.hpp"
+#include "flat_map/__search.hpp"
+#include "flat_map/search_policy.hpp"
+
+namespace flat_map {
+
+// Read-only snapshot of a flat container of arithmetic keys with a piecewise linear model of the
+// position of each key, so that lookups only search a window of a few cache lines around the
+// predicted position instead of the whole range.
+// The model is built in one pass by shrinking cone: each segment grows while some slope keeps
+// every key in it within epsilon of its position.
+template <typename Flat>
+class learned_index {
+   public:
+    using flat_type              = Flat;
+    using key_type               = typename Flat::key_type;
+    using value_type             = typename Flat::value_type;
+    using size_type              = typename Flat::size_type;
+    using key_compare            = typename Flat::key_compare;
+    using allocator_type         = typename Flat::allocator_type;
+    using const_reference        = typename Flat::const_reference;
+    using const_iterator         = typename Flat::const_iterator;
+    using const_reverse_iterator = typename Flat::const_reverse_iterator;
+
+    static_assert(
+        std::is_arithmetic_v<key_type> && !std::is_same_v<key_type, bool>,
+        "learned_index requires arithmetic keys"
+    );
+    static_assert(
+        std::is_same_v<key_compare, std::less<key_type>>
+            || std::is_same_v<key_compare, std::less<>>,
+        "learned_index requires keys in ascending order"
+    );
+
+   private:
+    // Line through (key, pos) of the first key in a segment.
+    struct _segment {
+        double    slope;
+        size_type pos;
+    };
+
+    Flat                  _flat;
+    size_type             _epsilon;
+    std::vector<key_type> _segment_keys;
+    std::vector<_segment> _segments;
+
+    template <typename V>
+    static key_type _key(V const& value) {
+        return detail::key_of<key_type>(value);
+    }
+
+    void _build() {
+        _segment_keys.clear();
+        _segments.clear();
+
+        auto const n     = _flat.size();
+        auto const first = _flat.begin();
+        auto const eps   = double(_epsilon);
+        auto       lo    = 0.0;
+        auto       hi    = std::numeric_limits<double>::infinity();
+        auto const close = [&] {
+            _segments.back().slope = hi == std::numeric_limits<double>::infinity()
+                                       ? lo
+                                       : lo + (hi - lo) / 2;
+        };
+        for (size_type i = 0; i < n; ++i) {
+            auto const key = _key(first[i]);
+            if (i != 0) {
+                if (!(_segment_keys.back() < key)) {
+                    // Equivalent keys are modeled by the first one.
+                    continue;
+                }
+                auto const dx     = detail::key_distance(_segment_keys.back(), key);
+                auto const dy     = double(i - _segments.back().pos);
+                auto const new_lo = std::max(lo, (dy - eps) / dx);
+                auto const new_hi = std::min(hi, (dy + eps) / dx);
+                if (new_lo <= new_hi) {
+                    lo = new_lo;
+                    hi = new_hi;
+                    continue;
+                }
+                close();
+            }
+            _segment_keys.push_back(key);
+            _segments.push_back({0.0, i});
+            lo = 0.0;
+            hi = std::numeric_limits<double>::infinity();
+        }
+        if (!_segments.empty()) {
+            close();
+        }
+    }
+
+    // Position of key predicted by the model, which is within epsilon (plus rounding) of the one
+    // of the first key not less than key.
+    size_type _predict(key_type const& key) const {
+        std::size_t seg;
+        if constexpr (detail::is_simd_searchable_v<key_type, std::less<key_type>, key_type>) {
+            seg = detail::simd_bound<false>(_segment_keys.data(), _segment_keys.size(), key);
+        } else {
+            seg = std::size_t(std::distance(
+                _segment_keys.begin(),
+                std::upper_bound(_segment_keys.begin(), _segment_keys.end(), key)
+            ));
+        }
+        if (seg == 0) {
+            return 0;
+        }
+        auto const dx  = detail::key_distance(_segment_keys[seg - 1], key);
+        auto const pos = double(_segments[seg - 1].pos) + _segments[seg - 1].slope * dx;
+        return size_type(std::min(pos, double(_flat.size())));
+    }
+
+    // Offset of lower bound (Strict == true) or upper bound (Strict == false) of key in [lo, hi),
+    // which is searched without branch as the window is short.
+    template <bool Strict>
+    size_type _search_window(size_type lo, size_type hi, key_type const& key) const {
+        auto const keys = detail::key_data_of<key_type>(_flat.get_container());
+        if constexpr (!std::is_null_pointer_v<decltype(keys)>
+                      && detail::is_simd_searchable_v<key_type, key_compare, key_type>) {
+            return lo + detail::simd_bound<Strict>(keys + lo, hi - lo, key);
+        } else {
+            auto const first = _flat.begin();
+            auto       n     = hi - lo;
+            if (n == 0) {
+                return lo;
+            }
+            while (n > 1) {
+                auto const half = n / 2;
+                auto const k    = _key(first[lo + half]);
+                lo += (Strict ? k < key : !(key < k)) ? half : 0;
+                n -= half;
+            }
+            auto const k = _key(first[lo]);
+            return lo + (Strict ? k < key : !(key < k));
+        }
+    }
+
+    // Same as lower bound (Strict == true) or upper bound (Strict == false) of Flat, but searches
+    // the window around the predicted position, and beyond it only if the window misses.
+    template <bool Strict>
+    const_iterator _bound(key_type const& key) const {
+        auto const n     = _flat.size();
+        auto const pos   = _predict(key);
+        auto const lo    = pos > _epsilon ? pos - _epsilon : 0;
+        auto const hi    = std::min(n, pos + _epsilon + 2);
+        auto const first = _flat.begin();
+        auto const pred  = [&](auto const& value) {
+            return Strict ? _key(value) < key : !(key < _key(value));
+        };
+
+        auto const offset = _search_window<Strict>(lo, hi, key);
+        if (offset == lo && lo != 0 && !pred(first[lo - 1])) {
+            return std::partition_point(first, std::next(first, lo), pred);
+        }
+        if (offset == hi && hi != n) {
+            return std::partition_point(std::next(first, hi), _flat.end(), pred);
+        }
+        return std::next(first, offset);
+    }
+
+    const_iterator _find(key_type const& key) const {
+        auto itr = _bound<true>(key);
+        return itr == end() || key < _key(*itr) ? end() : itr;
+    }
+
+   public:
+    // Smaller epsilon narrows the window to search, at the cost of more segments in the model.
+    explicit learned_index(Flat&& flat, size_type epsilon = 32)
+        : _flat{std::move(flat)}, _epsilon{epsilon} {
+        _build();
+    }
+
+    explicit learned_index(Flat const& flat, size_type epsilon = 32)
+        : learned_index{Flat(flat), epsilon} {}
+
+    learned_index(learned_index const&)            = default;
+    learned_index(learned_index&&)                 = default;
+    learned_index& operator=(learned_index const&) = default;
+    learned_index& operator=(learned_index&&)      = default;
+
+    // Drops the model and returns the elements for mutation.
+    Flat extract() && {
+        auto flat = std::move(_flat);
+        _flat.clear();
+        _segment_keys.clear();
+        _segments.clear();
+        return flat;
+    }
+
+    // Passes the underlying container to f for mutation, then rebuilds the model.
+    template <typename F>
+    void modify(F&& f) {
+        try {
+            std::forward<F>(f)(_flat);
+        } catch (...) {
+            _build();
+            throw;
+        }
+        _build();
+    }
+
+    allocator_type get_allocator() const noexcept { return _flat.get_allocator(); }
+
+    const_iterator         begin() const noexcept { return _flat.begin(); }
+    const_iterator         end() const noexcept { return _flat.end(); }
+    const_iterator         cbegin() const noexcept { return _flat.cbegin(); }
+    const_iterator         cend() const noexcept { return _flat.cend(); }
+    const_reverse_iterator rbegin() const noexcept { return _flat.rbegin(); }
+    const_reverse_iterator rend() const noexcept { return _flat.rend(); }
+
+    [[nodiscard]] bool empty() const noexcept { return _flat.empty(); }
+    size_type          size() const noexcept { return _flat.size(); }
+
+    size_type epsilon() const noexcept { return _epsilon; }
+    size_type segment_count() const noexcept { return _segments.size(); }
+
+    size_type count(key_type const& key) const {
+        auto [first, last] = equal_range(key);
+        return size_type(std::distance(first, last));
+    }
+
+    const_iterator find(key_type const& key) const { return _find(key); }
+
+    bool contains(key_type const& key) const { return _find(key) != end(); }
+
+    std::pair<const_iterator, const_iterator> equal_range(key_type const& key) const {
+        return {_bound<true>(key), _bound<false>(key)};
+    }
+
+    const_iterator lower_bound(key_type const& key) const { return _bound<true>(key); }
+
+    const_iterator upper_bound(key_type const& key) const { return _bound<false>(key); }
+
+    key_compare key_comp() const { return _flat.key_comp(); }
+
+    decltype(auto) get_container() const { return _flat.get_container(); }
+};
+
+}  // namespace flat_map
@@ -0,0 +1,358 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "flat_map/__flat_tree.hpp"
+#include "flat_map/__fwd.hpp"
+#include "flat_map/flat_map_view.hpp"
+#include "flat_map/flat_set_view.hpp"
+#include "flat_map/span_sequence.hpp"
+#include "flat_map/tied_sequence.hpp"
+
+namespace flat_map {
+
+namespace detail {
+
+// Layout of a file written by save(). The key column and the value column follow the header,
+// each of which starts at a multiple of mapped_alignment.
+struct mapped_header {
+    char          magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::uint64_t type_id;
+    std::uint64_t compare_id;
+    std::uint32_t key_size;
+    std::uint32_t value_size;
+    std::uint32_t is_map;
+    std::uint32_t is_multi;
+    std::uint64_t count;
+    std::uint64_t key_offset;
+    std::uint64_t value_offset;
+};
+
+inline constexpr char          mapped_magic[8]   = {'f', 'l', 'a', 't', '_', 'm', 'a', 'p'};
+inline constexpr std::uint32_t mapped_version    = 1;
+inline constexpr std::uint32_t mapped_byte_order = 0x01020304;
+inline constexpr std::uint64_t mapped_alignment  = 64;
+
+inline constexpr std::uint64_t mapped_align(std::uint64_t offset) noexcept {
+    return (offset + mapped_alignment - 1) / mapped_alignment * mapped_alignment;
+}
+
+// FNV-1a of the type name, which identifies types within the same toolchain.
+template <typename T>
+std::uint64_t mapped_type_id() noexcept {
+    std::uint64_t h = 14695981039346656037ull;
+    for (auto p = typeid(T).name(); *p; ++p) {
+        h = (h ^ static_cast<unsigned char>(*p)) * 1099511628211ull;
+    }
+    return h;
+}
+
+// Whether a flat container or a view can be saved or loaded, and its shape.
+template <typename Flat>
+struct mapped_traits {
+    static constexpr bool supported = false;
+};
+
+template <typename Key, typename T, typename Compare, bool Map, bool Multi>
+struct mapped_traits_base {
+    static constexpr bool supported = true;
+    static constexpr bool is_map    = Map;
+    static constexpr bool is_multi  = Multi;
+    using key_type                  = Key;
+    using value_type                = T;
+    using key_compare               = Compare;
+
+    static_assert(std::is_trivially_copyable_v<Key>, "keys should be trivially copyable");
+    static_assert(std::is_trivially_copyable_v<T>, "values should be trivially copyable");
+    static_assert(alignof(Key) <= mapped_alignment && alignof(T) <= mapped_alignment);
+};
+
+template <typename Key, typename T, typename Compare, typename Container>
+struct mapped_traits<flat_map<Key, T, Compare, Container>>
+    : mapped_traits_base<Key, T, Compare, true, false> {};
+
+template <typename Key, typename T, typename Compare, typename Container>
+struct mapped_traits<flat_multimap<Key, T, Compare, Container>>
+    : mapped_traits_base<Key, T, Compare, true, true> {};
+
+template <typename Key, typename Compare, typename Container>
+struct mapped_traits<flat_set<Key, Compare, Container>>
+    : mapped_traits_base<Key, Key, Compare, false, false> {};
+
+template <typename Key, typename Compare, typename Container>
+struct mapped_traits<flat_multiset<Key, Compare, Container>>
+    : mapped_traits_base<Key, Key, Compare, false, true> {};
+
+template <typename Key, typename T, typename Compare, typename Container>
+struct mapped_traits<flat_map_view<Key, T, Compare, Container>>
+    : mapped_traits_base<Key, T, Compare, true, false> {};
+
+template <typename Key, typename T, typename Compare, typename Container>
+struct mapped_traits<flat_multimap_view<Key, T, Compare, Container>>
+    : mapped_traits_base<Key, T, Compare, true, true> {};
+
+template <typename Key, typename Compare, typename Container>
+struct mapped_traits<flat_set_view<Key, Compare, Container>>
+    : mapped_traits_base<Key, Key, Compare, false, false> {};
+
+template <typename Key, typename Compare, typename Container>
+struct mapped_traits<flat_multiset_view<Key, Compare, Container>>
+    : mapped_traits_base<Key, Key, Compare, false, true> {};
+
+template <typename Traits>
+mapped_header make_mapped_header(std::uint64_t count) noexcept {
+    using key_type   = typename Traits::key_type;
+    using value_type = typename Traits::value_type;
+
+    mapped_header header{};
+    std::memcpy(header.magic, mapped_magic, sizeof(header.magic));
+    header.version    = mapped_version;
+    header.byte_order = mapped_byte_order;
+    header.type_id    = mapped_type_id<std::pair<key_type, value_type>>();
+    header.compare_id = mapped_type_id<typename Traits::key_compare>();
+    header.key_size   = sizeof(key_type);
+    header.value_size = Traits::is_map ? sizeof(value_type) : 0;
+    header.is_map     = Traits::is_map;
+    header.is_multi   = Traits::is_multi;
+    header.count      = count;
+    header.key_offset = mapped_align(sizeof(mapped_header));
+    header.value_offset =
+        Traits::is_map ? mapped_align(header.key_offset + count * sizeof(key_type)) : 0;
+    return header;
+}
+
+// Whether count elements of size bytes starting at offset are in a file of byte_size bytes.
+// It's checked by division, as a forged count would wrap the end of the column around.
+inline constexpr bool mapped_column_fits(
+    std::uint64_t byte_size, std::uint64_t offset, std::uint64_t count, std::uint64_t size
+) noexcept {
+    return offset <= byte_size && (size == 0 || count <= (byte_size - offset) / size);
+}
+
+// Writes f(element) of [first, last) in chunks, not to hold another copy of whole the column.
+template <typename Column, typename Iterator, typename F>
+void write_mapped_column(std::ofstream& out, Iterator first, Iterator last, F f) {
+    constexpr std::size_t chunk = 4096;
+
+    std::vector<Column> buffer;
+    buffer.reserve(chunk);
+    auto const flush = [&] {
+        out.write(
+            reinterpret_cast<char const*>(buffer.data()),
+            static_cast<std::streamsize>(buffer.size() * sizeof(Column))
+        );
+        buffer.clear();
+    };
+    for (; first != last; ++first) {
+        buffer.push_back(f(*first));
+        if (buffer.size() == chunk) {
+            flush();
+        }
+    }
+    flush();
+}
+
+inline void write_mapped_padding(std::ofstream& out, std::uint64_t offset) {
+    static constexpr char zeros[mapped_alignment] = {};
+
+    auto const pos = static_cast<std::uint64_t>(out.tellp());
+    out.write(zeros, static_cast<std::streamsize>(offset - pos));
+}
+
+// Read-only mapping of a whole file.
+class file_mapping {
+    void*       _addr = nullptr;
+    std::size_t _size = 0;
+
+   public:
+    file_mapping() = default;
+
+    explicit file_mapping(std::string const& path) {
+        auto const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw std::system_error(errno, std::generic_category(), path);
+        }
+        struct ::stat st;
+        if (::fstat(fd, &st) != 0) {
+            auto const e = errno;
+            ::close(fd);
+            throw std::system_error(e, std::generic_category(), path);
+        }
+        _size = static_cast<std::size_t>(st.st_size);
+        if (_size != 0) {
+            auto const addr = ::mmap(nullptr, _size, PROT_READ, MAP_SHARED, fd, 0);
+            if (addr == MAP_FAILED) {
+                auto const e = errno;
+                ::close(fd);
+                throw std::system_error(e, std::generic_category(), path);
+            }
+            _addr = addr;
+        }
+        ::close(fd);
+    }
+
+    file_mapping(file_mapping const&) = delete;
+    file_mapping(file_mapping&& other) noexcept
+        : _addr{std::exchange(other._addr, nullptr)}, _size{std::exchange(other._size, 0)} {}
+
+    file_mapping& operator=(file_mapping const&) = delete;
+    file_mapping& operator=(file_mapping&& other) noexcept {
+        file_mapping{std::move(other)}.swap(*this);
+        return *this;
+    }
+
+    ~file_mapping() {
+        if (_addr) {
+            ::munmap(_addr, _size);
+        }
+    }
+
+    void swap(file_mapping& other) noexcept {
+        std::swap(_addr, other._addr);
+        std::swap(_size, other._size);
+    }
+
+    // Not named data() and size(), which would be ambiguous with the ones of the views.
+    char const* bytes() const noexcept { return static_cast<char const*>(_addr); }
+    std::size_t byte_size() const noexcept { return _size; }
+};
+
+}  // namespace detail
+
+// Writes the elements of a flat container or a view to path, which can be loaded by mapped.
+// Key and mapped_type should be trivially copyable.
+template <typename Flat>
+std::enable_if_t<detail::mapped_traits<Flat>::supported> save(
+    Flat const& flat, std::string const& path
+) {
+    using traits     = detail::mapped_traits<Flat>;
+    using key_type   = typename traits::key_type;
+    using value_type = typename traits::value_type;
+
+    auto const header = detail::make_mapped_header<traits>(flat.size());
+
+    std::ofstream out;
+    out.exceptions(std::ios::failbit | std::ios::badbit);
+    out.open(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+
+    detail::write_mapped_padding(out, header.key_offset);
+    detail::write_mapped_column<key_type>(out, flat.begin(), flat.end(), [](auto const& e) {
+        return detail::key_of<key_type>(e);
+    });
+    if constexpr (traits::is_map) {
+        detail::write_mapped_padding(out, header.value_offset);
+        detail::write_mapped_column<value_type>(out, flat.begin(), flat.end(), [](auto const& e) {
+            return std::get<1>(e);
+        });
+    }
+    out.close();
+}
+
+// View over a file written by save(), which shares the pages with other processes mapping it.
+template <typename View>
+class mapped : private detail::file_mapping, public View {
+    using _traits = detail::mapped_traits<View>;
+
+    static_assert(_traits::supported, "View should be a view of this library");
+
+    static View _make_view(detail::file_mapping const& file, typename View::key_compare comp) {
+        using key_type   = typename _traits::key_type;
+        using value_type = typename _traits::value_type;
+
+        detail::mapped_header header;
+        if (file.byte_size() < sizeof(header)) {
+            throw std::runtime_error("flat_map: not a flat_map file");
+        }
+        std::memcpy(&header, file.bytes(), sizeof(header));
+        if (std::memcmp(header.magic, detail::mapped_magic, sizeof(header.magic)) != 0
+            || header.version != detail::mapped_version
+            || header.byte_order != detail::mapped_byte_order) {
+            throw std::runtime_error("flat_map: not a flat_map file");
+        }
+
+        auto const expected = detail::make_mapped_header<_traits>(header.count);
+        if (header.type_id != expected.type_id || header.key_size != expected.key_size
+            || header.value_size != expected.value_size || header.is_map != expected.is_map
+            || header.is_multi != expected.is_multi) {
+            throw std::runtime_error("flat_map: type mismatch");
+        }
+        if (header.compare_id != expected.compare_id) {
+            throw std::runtime_error("flat_map: comparator mismatch");
+        }
+        // The value offset derived from count is trusted only after count is checked.
+        if (header.key_offset != expected.key_offset
+            || !detail::mapped_column_fits(
+                file.byte_size(), header.key_offset, header.count, sizeof(key_type)
+            )
+            || header.value_offset != expected.value_offset
+            || !detail::mapped_column_fits(
+                file.byte_size(), header.value_offset, header.count, header.value_size
+            )) {
+            throw std::runtime_error("flat_map: truncated file");
+        }
+
+        auto const count = static_cast<std::size_t>(header.count);
+        auto const keys  = reinterpret_cast<key_type const*>(file.bytes() + header.key_offset);
+        if constexpr (_traits::is_map) {
+            auto const values =
+                reinterpret_cast<value_type const*>(file.bytes() + header.value_offset);
+            return View{keys, values, count, comp};
+        } else {
+            return View{keys, count, comp};
+        }
+    }
+
+   public:
+    using view_type   = View;
+    using key_compare = typename View::key_compare;
+
+    mapped() = default;
+
+    explicit mapped(std::string const& path, key_compare const& comp = key_compare())
+        : detail::file_mapping{path}, View{_make_view(*this, comp)} {}
+
+    mapped(mapped&&)            = default;
+    mapped& operator=(mapped&&) = default;
+
+    View const& view() const noexcept { return *this; }
+};
+
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using mapped_flat_map = mapped<
+    flat_map_view<Key, T, Compare, tied_sequence<span_sequence<Key>, span_sequence<T>>>>;
+
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using mapped_flat_multimap = mapped<
+    flat_multimap_view<Key, T, Compare, tied_sequence<span_sequence<Key>, span_sequence<T>>>>;
+
+template <typename Key, typename Compare = std::less<Key>>
+using mapped_flat_set = mapped<flat_set_view<Key, Compare>>;
+
+template <typename Key, typename Compare = std::less<Key>>
+using mapped_flat_multiset = mapped<flat_multiset_view<Key, Compare>>;
+
+}  // namespace flat_map
@@ -0,0 +1,142 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace flat_map {
+
+// Flat containers scan ranges shorter than value linearly instead of binary search, as the scan
+// has no mispredicted branch and stays on a few cache lines.
+// Specialize it for Key and Compare to tune the threshold, where 0 always uses binary search.
+template <typename Key, typename Compare, typename = void>
+struct linear_search_threshold
+    : public std::integral_constant<std::size_t, std::is_scalar_v<Key> ? 16 : 0> {};
+
+// Searches by binary search, or by the linear scan for short ranges.
+struct binary_search_policy {};
+
+// Same as binary_search_policy, but the insertions with a hint search exponentially outward from
+// the hint, which takes O(log(D)) for the distance D between the hint and the insertion point.
+struct exponential_search_policy {};
+
+// Same as exponential_search_policy, but lookups probe the position interpolated from the keys at
+// both ends of the range, which takes O(log(log(N))) on uniformly distributed keys such as
+// sequential IDs or timestamps. Once a probe doesn't halve the range, the rest is searched by
+// binary search, so that skewed keys take O(log(N)) at worst.
+// It requires arithmetic keys ordered by std::less, std::less<>, or a class derived from them.
+struct interpolation_search_policy {};
+
+// Specialize it for Key and Compare to select one of the policies above.
+template <typename Key, typename Compare, typename = void>
+struct search_policy {
+    using type = binary_search_policy;
+};
+
+namespace detail {
+
+template <typename Key, typename Compare>
+using search_policy_t = typename search_policy<Key, Compare>::type;
+
+// Distance from from to to (from <= to) as double, without overflow of signed integers.
+template <typename Key>
+constexpr double key_distance(Key from, Key to) noexcept {
+    if constexpr (std::is_integral_v<Key>) {
+        using unsigned_type = std::make_unsigned_t<Key>;
+        return double(unsigned_type(unsigned_type(to) - unsigned_type(from)));
+    } else {
+        return double(to) - double(from);
+    }
+}
+
+template <typename Key, typename Compare>
+inline constexpr std::size_t linear_search_threshold_v =
+    linear_search_threshold<Key, Compare>::value;
+
+// Returns the offset of lower bound (Strict == true) or upper bound (Strict == false) in
+// [first, first + n), by counting the elements which precede key without branch.
+template <bool Strict, typename RandomAccessIterator, typename K, typename Compare>
+constexpr std::size_t linear_bound(
+    RandomAccessIterator first, std::size_t n, K const& key, Compare const& comp
+) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        count += Strict ? comp(first[i], key) : !comp(key, first[i]);
+    }
+    return count;
+}
+
+// Narrows [first, first + n) down to the subrange [lo, hi] which contains the offset of lower bound
+// (Strict == true) or upper bound (Strict == false) of key by interpolation search, where proj
+// gives the arithmetic key of an element.
+// Each round gallops from the interpolated position toward key until both sides are bracketed, so
+// that the next round interpolates over the error of the last one. It gives up as soon as a round
+// doesn't halve the range, so that skewed keys cost only a few probes before binary search.
+template <bool Strict, typename RandomAccessIterator, typename K, typename Projection>
+constexpr std::pair<std::size_t, std::size_t> interpolation_narrow(
+    RandomAccessIterator first, std::size_t n, K const& key, Projection const& proj
+) {
+    constexpr std::size_t min_width = 64;
+
+    auto const precedes = [&](auto const& k) { return Strict ? k < key : !(key < k); };
+    if (n <= min_width) {
+        return {0, n};
+    }
+    auto left  = proj(first[0]);
+    auto right = proj(first[n - 1]);
+    if (!precedes(left)) {
+        return {0, 0};
+    }
+    if (precedes(right)) {
+        return {n, n};
+    }
+    // The keys at lo - 1 (left) and hi (right) bracket key.
+    std::size_t lo = 1;
+    std::size_t hi = n - 1;
+    while (hi - lo > min_width) {
+        auto const width = hi - lo;
+        auto const ratio = key_distance(left, key) / key_distance(left, right);
+        // The ratio is NaN if both distances overflow to infinity.
+        auto const offset = ratio > 0 ? std::min(ratio, 1.0) * double(width) : 0.0;
+        auto const mid    = std::min(lo + std::size_t(offset), hi - 1);
+        if (auto const k = proj(first[mid]); precedes(k)) {
+            left = k;
+            lo   = mid + 1;
+            for (std::size_t step = 1; step < hi - mid; step *= 2) {
+                auto const next = proj(first[mid + step]);
+                if (!precedes(next)) {
+                    right = next;
+                    hi    = mid + step;
+                    break;
+                }
+                left = next;
+                lo   = mid + step + 1;
+            }
+        } else {
+            right = k;
+            hi    = mid;
+            for (std::size_t step = 1; step <= mid - lo; step *= 2) {
+                auto const prev = proj(first[mid - step]);
+                if (precedes(prev)) {
+                    left = prev;
+                    lo   = mid - step + 1;
+                    break;
+                }
+                right = prev;
+                hi    = mid - step;
+            }
+        }
+        if (hi - lo > width / 2) {
+            break;
+        }
+    }
+    return {lo, hi};
+}
+
+}  // namespace detail
+
+}  // namespace flat_map
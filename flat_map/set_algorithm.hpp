@@ -0,0 +1,457 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__)
+#    include <immintrin.h>
+#endif
+
+#include "flat_map/__concepts.hpp"
+#include "flat_map/__flat_tree.hpp"
+#include "flat_map/__fwd.hpp"
+#include "flat_map/__search.hpp"
+#include "flat_map/enum.hpp"
+
+namespace flat_map {
+
+namespace detail {
+
+// Whether set operations are defined on Flat, and the order of their results.
+template <typename Flat>
+struct set_traits {
+    static constexpr bool supported = false;
+};
+
+template <typename Key, typename T, typename Compare, typename Container>
+struct set_traits<flat_map<Key, T, Compare, Container>> {
+    static constexpr bool        supported = true;
+    static constexpr range_order order     = range_order::unique_sorted;
+};
+
+template <typename Key, typename T, typename Compare, typename Container>
+struct set_traits<flat_multimap<Key, T, Compare, Container>> {
+    static constexpr bool        supported = true;
+    static constexpr range_order order     = range_order::sorted;
+};
+
+template <typename Key, typename Compare, typename Container>
+struct set_traits<flat_set<Key, Compare, Container>> {
+    static constexpr bool        supported = true;
+    static constexpr range_order order     = range_order::unique_sorted;
+};
+
+template <typename Key, typename Compare, typename Container>
+struct set_traits<flat_multiset<Key, Compare, Container>> {
+    static constexpr bool        supported = true;
+    static constexpr range_order order     = range_order::sorted;
+};
+
+template <typename Flat, typename R>
+using enable_if_set_t = std::enable_if_t<set_traits<Flat>::supported, R>;
+
+// Ratio of sizes from which each element of the smaller one is searched in the larger one by
+// galloping, instead of walking both.
+inline constexpr std::size_t set_gallop_ratio = 8;
+
+template <typename Flat>
+using set_container_t = std::decay_t<decltype(std::declval<Flat const&>().get_container())>;
+
+// Whether keys of Flat are integers in a contiguous column ordered by std::less.
+template <typename Flat, typename Key = typename Flat::key_type>
+inline constexpr bool is_simd_set_v =
+    std::is_integral_v<Key> && is_simd_searchable_v<Key, typename Flat::key_compare, Key>
+    && !std::is_null_pointer_v<
+        decltype(key_data_of<Key>(std::declval<set_container_t<Flat> const&>()))>;
+
+template <typename Flat>
+auto set_key_data(Flat const& flat) noexcept {
+    return key_data_of<typename Flat::key_type>(flat.get_container());
+}
+
+// Number of the elements in both of sorted [a, a + n) and [b, b + m) without duplicates.
+// For 32-bit keys, blocks of both are compared all-to-all by rotating one of them, then the one
+// with the smaller last element is advanced. Two 64-bit lanes don't pay for the rotations, so the
+// rest is walked without branch.
+template <typename T>
+std::size_t simd_intersection_size(T const* a, std::size_t n, T const* b, std::size_t m) noexcept {
+    std::size_t count = 0;
+    std::size_t i     = 0;
+    std::size_t j     = 0;
+#if defined(__SSE2__)
+    if constexpr (sizeof(T) == 4) {
+        constexpr std::size_t lanes = 4;
+        while (i + lanes <= n && j + lanes <= m) {
+            auto const va = _mm_loadu_si128(reinterpret_cast<__m128i const*>(a + i));
+            auto       vb = _mm_loadu_si128(reinterpret_cast<__m128i const*>(b + j));
+            auto       eq = _mm_cmpeq_epi32(va, vb);
+            for (std::size_t r = 1; r < lanes; ++r) {
+                vb = _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1));
+                eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, vb));
+            }
+            count += __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(eq)));
+
+            auto const a_last = a[i + lanes - 1];
+            auto const b_last = b[j + lanes - 1];
+            i += a_last <= b_last ? lanes : 0;
+            j += b_last <= a_last ? lanes : 0;
+        }
+    }
+#endif
+    while (i < n && j < m) {
+        auto const x = a[i];
+        auto const y = b[j];
+        count += x == y;
+        i += x <= y;
+        j += y <= x;
+    }
+    return count;
+}
+
+// Lower bound of key in [from, end of flat), which is searched by doubling steps from the front,
+// then by binary search. For integer keys, the first step covers a cache line, which is counted by
+// SIMD without branch, so that near keys cost as little as walking.
+template <typename Flat, typename Iterator, typename K>
+Iterator set_gallop(Flat const& flat, Iterator from, K const& key) {
+    using key_type = typename Flat::key_type;
+
+    constexpr std::size_t step = is_simd_set_v<Flat> ? 64 / sizeof(key_type) : 1;
+
+    auto const  comp = flat.key_comp();
+    auto const  n    = static_cast<std::size_t>(std::distance(from, flat.end()));
+    std::size_t lo   = 0;
+    std::size_t hi   = std::min(n, step);
+    for (std::size_t width = step;
+         hi < n && comp(key_of<key_type>(*std::next(from, hi - 1)), key);
+         width *= 2) {
+        lo = hi;
+        hi = std::min(n, hi + width);
+    }
+
+    auto const first = std::next(from, lo);
+    if constexpr (is_simd_set_v<Flat>) {
+        auto const keys = set_key_data(flat) + std::distance(flat.begin(), first);
+        return std::next(first, simd_bound<true>(keys, hi - lo, key));
+    } else {
+        return std::lower_bound(first, std::next(from, hi), key, [&](auto const& e, K const& k) {
+            return comp(key_of<key_type>(e), k);
+        });
+    }
+}
+
+// Walks sorted a and b as std::set_* algorithms do, and reports the runs of elements only in a
+// or b, and each pair of equivalent elements in both.
+// If one is much smaller than the other, each element of the smaller one is galloped through the
+// larger one on construction, and the lower bounds are kept so that walks don't search again.
+// Otherwise, both are walked linearly.
+template <typename Flat>
+class set_walker {
+    using key_type = typename Flat::key_type;
+
+    Flat const&              _a;
+    Flat const&              _b;
+    bool                     _gallop_a = false;
+    bool                     _gallop_b = false;
+    std::vector<std::size_t> _bounds;
+    std::size_t              _both = 0;
+
+   public:
+    set_walker(Flat const& a, Flat const& b) : _a{a}, _b{b} {
+        if (b.size() >= a.size() * set_gallop_ratio) {
+            _gallop_a = true;
+            _both     = _locate(a, b);
+        } else if (a.size() >= b.size() * set_gallop_ratio) {
+            _gallop_b = true;
+            _both     = _locate(b, a);
+        } else if constexpr (is_simd_set_v<Flat>
+                             && set_traits<Flat>::order == range_order::unique_sorted) {
+            _both = simd_intersection_size(set_key_data(a), a.size(), set_key_data(b), b.size());
+        } else {
+            auto const skip = [](auto, auto) {};
+            _walk_linear(skip, skip, [&](auto, auto) { ++_both; });
+        }
+    }
+
+    // Number of the pairs of equivalent elements, which is the size of std::set_intersection.
+    std::size_t both() const noexcept { return _both; }
+
+    // Whether both are walked linearly.
+    bool linear() const noexcept { return !_gallop_a && !_gallop_b; }
+
+    template <typename OnlyA, typename OnlyB, typename Both>
+    void operator()(OnlyA&& only_a, OnlyB&& only_b, Both&& both) const {
+        if (_gallop_a) {
+            _walk_gallop(_a, _b, only_a, only_b, both);
+        } else if (_gallop_b) {
+            _walk_gallop(_b, _a, only_b, only_a, [&](auto itr_b, auto itr_a) {
+                both(itr_a, itr_b);
+            });
+        } else {
+            _walk_linear(only_a, only_b, both);
+        }
+    }
+
+   private:
+    // Gallops each element of small through large from the last matched position, and keeps the
+    // lower bounds. Returns the number of the matched elements.
+    std::size_t _locate(Flat const& small, Flat const& large) {
+        auto const  comp  = small.key_comp();
+        std::size_t count = 0;
+
+        _bounds.reserve(small.size());
+        auto pos = large.begin();
+        for (auto const& e : small) {
+            auto const& key = key_of<key_type>(e);
+            auto const  lb  = set_gallop(large, pos, key);
+            _bounds.push_back(static_cast<std::size_t>(std::distance(large.begin(), lb)));
+            if (lb != large.end() && !comp(key, key_of<key_type>(*lb))) {
+                ++count;
+                pos = std::next(lb);
+            } else {
+                pos = lb;
+            }
+        }
+        return count;
+    }
+
+    template <typename OnlySmall, typename OnlyLarge, typename Both>
+    void _walk_gallop(
+        Flat const& small,
+        Flat const& large,
+        OnlySmall&  only_small,
+        OnlyLarge&  only_large,
+        Both&&      both
+    ) const {
+        auto const comp = small.key_comp();
+
+        auto pos   = large.begin();
+        auto bound = _bounds.begin();
+        for (auto itr = small.begin(); itr != small.end(); ++itr, ++bound) {
+            auto const lb = std::next(large.begin(), static_cast<std::ptrdiff_t>(*bound));
+            if (pos != lb) {
+                only_large(pos, lb);
+            }
+            if (lb != large.end() && !comp(key_of<key_type>(*itr), key_of<key_type>(*lb))) {
+                both(itr, lb);
+                pos = std::next(lb);
+            } else {
+                only_small(itr, std::next(itr));
+                pos = lb;
+            }
+        }
+        if (pos != large.end()) {
+            only_large(pos, large.end());
+        }
+    }
+
+    template <typename OnlyA, typename OnlyB, typename Both>
+    void _walk_linear(OnlyA&& only_a, OnlyB&& only_b, Both&& both) const {
+        auto const comp = _a.key_comp();
+
+        auto i = _a.begin();
+        auto j = _b.begin();
+        while (i != _a.end() && j != _b.end()) {
+            auto const& ka = key_of<key_type>(*i);
+            auto const& kb = key_of<key_type>(*j);
+            if (comp(ka, kb)) {
+                auto const run = i;
+                do {
+                    ++i;
+                } while (i != _a.end() && comp(key_of<key_type>(*i), kb));
+                only_a(run, i);
+            } else if (comp(kb, ka)) {
+                auto const run = j;
+                do {
+                    ++j;
+                } while (j != _b.end() && comp(key_of<key_type>(*j), ka));
+                only_b(run, j);
+            } else {
+                both(i, j);
+                ++i;
+                ++j;
+            }
+        }
+        if (i != _a.end()) {
+            only_a(i, _a.end());
+        }
+        if (j != _b.end()) {
+            only_b(j, _b.end());
+        }
+    }
+};
+
+// Appends runs of elements to a container, joining adjacent runs of the same source.
+template <typename Container, typename Iterator>
+class set_sink {
+    Container& _out;
+    Iterator   _first;
+    Iterator   _last;
+    int        _source = -1;
+
+   public:
+    explicit set_sink(Container& out) : _out{out} {}
+
+    void append(int source, Iterator first, Iterator last) {
+        if (source == _source && first == _last) {
+            _last = last;
+            return;
+        }
+        flush();
+        _source = source;
+        _first  = first;
+        _last   = last;
+    }
+
+    void flush() {
+        if (_source >= 0) {
+            _out.insert(_out.end(), _first, _last);
+        }
+        _source = -1;
+    }
+};
+
+enum class set_operation { union_, intersection, difference, symmetric_difference };
+
+// Whether Flat is a unique set of integers in a resizable contiguous container, on which
+// set_operate runs without branch.
+template <typename Flat>
+inline constexpr bool is_raw_set_v =
+    is_simd_set_v<Flat> && std::is_same_v<typename Flat::value_type, typename Flat::key_type>
+    && set_traits<Flat>::order == range_order::unique_sorted
+    && concepts::Resizable<set_container_t<Flat>>;
+
+// Writes the result of Op on sorted [a, a + n) and [b, b + m) without duplicates to
+// [out, out + size), where size is the exact size of the result.
+// Every step writes a candidate and advances the output by the result of comparison, instead of
+// branching on it.
+template <set_operation Op, typename T>
+void raw_set_operate(
+    T const* a, std::size_t n, T const* b, std::size_t m, T* out, std::size_t size
+) noexcept {
+    std::size_t i = 0;
+    std::size_t j = 0;
+    std::size_t k = 0;
+    while (k < size && i < n && j < m) {
+        auto const x = a[i];
+        auto const y = b[j];
+        if constexpr (Op == set_operation::union_) {
+            out[k] = y < x ? y : x;
+            k += 1;
+        } else if constexpr (Op == set_operation::intersection) {
+            out[k] = x;
+            k += x == y;
+        } else if constexpr (Op == set_operation::difference) {
+            out[k] = x;
+            k += x < y;
+        } else {
+            out[k] = y < x ? y : x;
+            k += x != y;
+        }
+        i += x <= y;
+        j += y <= x;
+    }
+    if constexpr (Op != set_operation::intersection) {
+        auto const rest_a = std::min(n - i, size - k);
+        std::copy_n(a + i, rest_a, out + k);
+        k += rest_a;
+    }
+    if constexpr (Op == set_operation::union_ || Op == set_operation::symmetric_difference) {
+        std::copy_n(b + j, std::min(m - j, size - k), out + k);
+    }
+}
+
+// Builds the result of Op on a and b in a container reserved for its exact size.
+// Balanced sets of integers are walked by the branchless kernels, and the others are built from
+// the runs reported by set_walker, which are copied directly to the result for sets of integers.
+template <set_operation Op, typename Flat>
+Flat set_operate(Flat const& a, Flat const& b) {
+    using container_type = set_container_t<Flat>;
+
+    set_walker<Flat> const walk{a, b};
+
+    auto const both = walk.both();
+    auto const size = Op == set_operation::union_         ? a.size() + b.size() - both
+                      : Op == set_operation::intersection ? both
+                      : Op == set_operation::difference   ? a.size() - both
+                                                          : a.size() + b.size() - 2 * both;
+
+    // Reports each run of elements of the result to emit(source, first, last).
+    auto const build = [&](auto&& emit) {
+        walk(
+            [&](auto first, auto last) {
+                if constexpr (Op != set_operation::intersection) {
+                    emit(0, first, last);
+                }
+            },
+            [&](auto first, auto last) {
+                if constexpr (Op == set_operation::union_
+                              || Op == set_operation::symmetric_difference) {
+                    emit(1, first, last);
+                }
+            },
+            [&](auto itr_a, auto) {
+                if constexpr (Op == set_operation::union_ || Op == set_operation::intersection) {
+                    emit(0, itr_a, std::next(itr_a));
+                }
+            }
+        );
+    };
+
+    container_type out(a.get_allocator());
+    if constexpr (is_raw_set_v<Flat>) {
+        out.resize(size);
+        if (walk.linear()) {
+            raw_set_operate<Op>(
+                set_key_data(a), a.size(), set_key_data(b), b.size(), out.data(), size
+            );
+        } else {
+            build([dst = out.data()](int, auto first, auto last) mutable {
+                dst = std::copy(first, last, dst);
+            });
+        }
+    } else {
+        if constexpr (concepts::Reservable<container_type>) {
+            out.reserve(size);
+        }
+        set_sink<container_type, typename Flat::const_iterator> sink{out};
+        build([&](int source, auto first, auto last) { sink.append(source, first, last); });
+        sink.flush();
+    }
+    return Flat(set_traits<Flat>::order, std::move(out), a.key_comp());
+}
+
+}  // namespace detail
+
+// Elements in a or b. Equivalent elements are taken from a, as std::set_union.
+template <typename Flat>
+detail::enable_if_set_t<Flat, Flat> set_union(Flat const& a, Flat const& b) {
+    return detail::set_operate<detail::set_operation::union_>(a, b);
+}
+
+// Elements of a which are also in b.
+template <typename Flat>
+detail::enable_if_set_t<Flat, Flat> set_intersection(Flat const& a, Flat const& b) {
+    return detail::set_operate<detail::set_operation::intersection>(a, b);
+}
+
+// Elements of a which aren't in b.
+template <typename Flat>
+detail::enable_if_set_t<Flat, Flat> set_difference(Flat const& a, Flat const& b) {
+    return detail::set_operate<detail::set_operation::difference>(a, b);
+}
+
+// Elements in either a or b, but not in both.
+template <typename Flat>
+detail::enable_if_set_t<Flat, Flat> set_symmetric_difference(Flat const& a, Flat const& b) {
+    return detail::set_operate<detail::set_operation::symmetric_difference>(a, b);
+}
+
+}  // namespace flat_map
@@ -0,0 +1,520 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "flat_map/__config.hpp"
+
+namespace flat_map {
+
+// Contiguous sequence which holds up to N elements in itself, and moves them to the heap when it
+// grows beyond that. Until then, no allocation is made.
+template <typename T, std::size_t N, typename Allocator = std::allocator<T>>
+class small_vector : private Allocator {
+    static_assert(N > 0, "use std::vector for no inline capacity");
+
+    using _alloc_traits = std::allocator_traits<Allocator>;
+
+   public:
+    using value_type             = T;
+    using allocator_type         = Allocator;
+    using size_type              = std::size_t;
+    using difference_type        = std::ptrdiff_t;
+    using reference              = T&;
+    using const_reference        = T const&;
+    using pointer                = T*;
+    using const_pointer          = T const*;
+    using iterator               = T*;
+    using const_iterator         = T const*;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr size_type inline_capacity = N;
+
+   private:
+    T*        _data;
+    size_type _size     = 0;
+    size_type _capacity = N;
+    alignas(T) unsigned char _storage[sizeof(T) * N];
+
+    Allocator&       _alloc() noexcept { return *this; }
+    Allocator const& _alloc() const noexcept { return *this; }
+
+    T* _inline_data() noexcept { return reinterpret_cast<T*>(_storage); }
+
+    bool _is_inline() const noexcept { return _capacity == N; }
+
+    static void _relocate(T* first, T* last, T* out) {
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+            std::uninitialized_move(first, last, out);
+        } else {
+            std::uninitialized_copy(first, last, out);
+        }
+    }
+
+    void _deallocate() noexcept {
+        if (!_is_inline()) {
+            _alloc_traits::deallocate(_alloc(), _data, _capacity);
+        }
+    }
+
+    size_type _grown_capacity(size_type required) const {
+        if (required > max_size()) {
+            throw std::length_error{"small_vector"};
+        }
+        return std::max(required, std::min(max_size(), _capacity * 2));
+    }
+
+    // Moves all elements to new storage of new_capacity, leaving the gap of n elements at index,
+    // which are constructed by construct(pointer to the gap) in advance of moving the others.
+    // If constructing them throws, the sequence is not changed.
+    template <typename Construct>
+    void _reallocate(size_type new_capacity, size_type index, size_type n, Construct construct) {
+        auto const to_inline = new_capacity == N;
+        auto const data =
+            to_inline ? _inline_data() : _alloc_traits::allocate(_alloc(), new_capacity);
+        try {
+            construct(data + index);
+        } catch (...) {
+            if (!to_inline) {
+                _alloc_traits::deallocate(_alloc(), data, new_capacity);
+            }
+            throw;
+        }
+        try {
+            _relocate(_data, _data + index, data);
+            try {
+                _relocate(_data + index, _data + _size, data + index + n);
+            } catch (...) {
+                std::destroy_n(data, index);
+                throw;
+            }
+        } catch (...) {
+            std::destroy_n(data + index, n);
+            if (!to_inline) {
+                _alloc_traits::deallocate(_alloc(), data, new_capacity);
+            }
+            throw;
+        }
+
+        std::destroy_n(_data, _size);
+        _deallocate();
+        _data     = data;
+        _capacity = new_capacity;
+        _size += n;
+    }
+
+    // Appends n elements constructed by construct(pointer to the tail).
+    template <typename Construct>
+    void _append(size_type n, Construct construct) {
+        if (_size + n > _capacity) {
+            _reallocate(_grown_capacity(_size + n), _size, n, construct);
+        } else {
+            construct(_data + _size);
+            _size += n;
+        }
+    }
+
+    template <typename InputIterator>
+    void _append_range(InputIterator first, InputIterator last) {
+        _insert(
+            _size,
+            first,
+            last,
+            typename std::iterator_traits<InputIterator>::iterator_category{}
+        );
+    }
+
+    // Moves the elements appended after old_size to index.
+    iterator _rotate_to(size_type index, size_type old_size) {
+        std::rotate(_data + index, _data + old_size, _data + _size);
+        return _data + index;
+    }
+
+    template <typename InputIterator>
+    iterator _insert(
+        size_type index, InputIterator first, InputIterator last, std::input_iterator_tag
+    ) {
+        auto const old_size = _size;
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+        return _rotate_to(index, old_size);
+    }
+
+    template <typename ForwardIterator>
+    iterator _insert(
+        size_type index, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag
+    ) {
+        auto const n = static_cast<size_type>(std::distance(first, last));
+        if (_size + n > _capacity) {
+            _reallocate(_grown_capacity(_size + n), index, n, [&](T* dst) {
+                std::uninitialized_copy(first, last, dst);
+            });
+            return _data + index;
+        }
+        auto const old_size = _size;
+        _append(n, [&](T* dst) { std::uninitialized_copy(first, last, dst); });
+        return _rotate_to(index, old_size);
+    }
+
+    // Takes the elements of other, which is left empty.
+    void _steal(small_vector& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (other._is_inline()) {
+            _relocate(other._data, other._data + other._size, _data);
+            _size = other._size;
+            other.clear();
+        } else {
+            _data     = std::exchange(other._data, other._inline_data());
+            _size     = std::exchange(other._size, 0);
+            _capacity = std::exchange(other._capacity, N);
+        }
+    }
+
+   public:
+    small_vector() noexcept(std::is_nothrow_default_constructible_v<Allocator>)
+        : _data{_inline_data()} {}
+
+    explicit small_vector(allocator_type const& alloc) noexcept
+        : Allocator(alloc), _data{_inline_data()} {}
+
+    explicit small_vector(size_type count, allocator_type const& alloc = allocator_type())
+        : small_vector(alloc) {
+        resize(count);
+    }
+
+    small_vector(
+        size_type count, value_type const& value, allocator_type const& alloc = allocator_type()
+    )
+        : small_vector(alloc) {
+        resize(count, value);
+    }
+
+    template <
+        typename InputIterator,
+        typename = typename std::iterator_traits<InputIterator>::iterator_category>
+    small_vector(
+        InputIterator first, InputIterator last, allocator_type const& alloc = allocator_type()
+    )
+        : small_vector(alloc) {
+        _append_range(first, last);
+    }
+
+    small_vector(
+        std::initializer_list<value_type> init, allocator_type const& alloc = allocator_type()
+    )
+        : small_vector(init.begin(), init.end(), alloc) {}
+
+    small_vector(small_vector const& other)
+        : small_vector(
+            other.begin(),
+            other.end(),
+            _alloc_traits::select_on_container_copy_construction(other._alloc())
+        ) {}
+
+    small_vector(small_vector const& other, allocator_type const& alloc)
+        : small_vector(other.begin(), other.end(), alloc) {}
+
+    small_vector(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : Allocator(other._alloc()), _data{_inline_data()} {
+        _steal(other);
+    }
+
+    small_vector(small_vector&& other, allocator_type const& alloc) : small_vector(alloc) {
+        if (alloc == other._alloc()) {
+            _steal(other);
+        } else {
+            assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+        }
+    }
+
+    ~small_vector() {
+        std::destroy_n(_data, _size);
+        _deallocate();
+    }
+
+    small_vector& operator=(small_vector const& other) {
+        if (this != &other) {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    small_vector& operator=(small_vector&& other) noexcept(
+        std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>
+    ) {
+        if (this == &other) {
+            return *this;
+        }
+        if (other._is_inline() || !(_alloc() == other._alloc())) {
+            assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+            other.clear();
+        } else {
+            clear();
+            _deallocate();
+            _data     = _inline_data();
+            _capacity = N;
+            _steal(other);
+        }
+        return *this;
+    }
+
+    small_vector& operator=(std::initializer_list<value_type> ilist) {
+        assign(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+    void assign(size_type count, value_type const& value) {
+        clear();
+        resize(count, value);
+    }
+
+    template <
+        typename InputIterator,
+        typename = typename std::iterator_traits<InputIterator>::iterator_category>
+    void assign(InputIterator first, InputIterator last) {
+        clear();
+        _append_range(first, last);
+    }
+
+    void assign(std::initializer_list<value_type> ilist) { assign(ilist.begin(), ilist.end()); }
+
+    allocator_type get_allocator() const noexcept { return _alloc(); }
+
+    reference at(size_type pos) {
+        if (!(pos < size())) {
+            throw std::out_of_range{"small_vector::at"};
+        }
+        return _data[pos];
+    }
+
+    const_reference at(size_type pos) const { return const_cast<small_vector*>(this)->at(pos); }
+
+    reference       operator[](size_type pos) noexcept { return _data[pos]; }
+    const_reference operator[](size_type pos) const noexcept { return _data[pos]; }
+
+    reference       front() noexcept { return _data[0]; }
+    const_reference front() const noexcept { return _data[0]; }
+    reference       back() noexcept { return _data[_size - 1]; }
+    const_reference back() const noexcept { return _data[_size - 1]; }
+
+    T*       data() noexcept { return _data; }
+    T const* data() const noexcept { return _data; }
+
+    iterator       begin() noexcept { return _data; }
+    const_iterator begin() const noexcept { return _data; }
+    const_iterator cbegin() const noexcept { return begin(); }
+    iterator       end() noexcept { return _data + _size; }
+    const_iterator end() const noexcept { return _data + _size; }
+    const_iterator cend() const noexcept { return end(); }
+
+    reverse_iterator       rbegin() noexcept { return reverse_iterator{end()}; }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator{end()}; }
+    const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+    reverse_iterator       rend() noexcept { return reverse_iterator{begin()}; }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator{begin()}; }
+    const_reverse_iterator crend() const noexcept { return rend(); }
+
+    [[nodiscard]] bool empty() const noexcept { return _size == 0; }
+    size_type          size() const noexcept { return _size; }
+    size_type          max_size() const noexcept { return _alloc_traits::max_size(_alloc()); }
+
+    void reserve(size_type new_cap) {
+        if (new_cap > max_size()) {
+            throw std::length_error{"small_vector"};
+        }
+        if (new_cap > _capacity) {
+            _reallocate(new_cap, _size, 0, [](T*) {});
+        }
+    }
+
+    size_type capacity() const noexcept { return _capacity; }
+
+    // Moves the elements back to the inline storage if they fit in it.
+    void shrink_to_fit() {
+        if (!_is_inline() && _size < _capacity) {
+            _reallocate(std::max(_size, N), _size, 0, [](T*) {});
+        }
+    }
+
+    void clear() noexcept {
+        std::destroy_n(_data, _size);
+        _size = 0;
+    }
+
+    iterator insert(const_iterator pos, value_type const& value) { return emplace(pos, value); }
+
+    iterator insert(const_iterator pos, value_type&& value) {
+        return emplace(pos, std::move(value));
+    }
+
+    iterator insert(const_iterator pos, size_type count, value_type const& value) {
+        auto const index    = static_cast<size_type>(pos - _data);
+        auto const old_size = _size;
+        value_type tmp(value);
+        _append(count, [&](T* dst) { std::uninitialized_fill_n(dst, count, tmp); });
+        return _rotate_to(index, old_size);
+    }
+
+    template <
+        typename InputIterator,
+        typename = typename std::iterator_traits<InputIterator>::iterator_category>
+    iterator insert(const_iterator pos, InputIterator first, InputIterator last) {
+        return _insert(
+            static_cast<size_type>(pos - _data),
+            first,
+            last,
+            typename std::iterator_traits<InputIterator>::iterator_category{}
+        );
+    }
+
+    iterator insert(const_iterator pos, std::initializer_list<value_type> ilist) {
+        return insert(pos, ilist.begin(), ilist.end());
+    }
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        auto const index = static_cast<size_type>(pos - _data);
+        if (_size == _capacity) {
+            _reallocate(_grown_capacity(_size + 1), index, 1, [&](T* dst) {
+                ::new (static_cast<void*>(dst)) T(std::forward<Args>(args)...);
+            });
+        } else if (index == _size) {
+            ::new (static_cast<void*>(_data + _size)) T(std::forward<Args>(args)...);
+            ++_size;
+        } else {
+            // Constructs the value first, as args may refer an element which is moved.
+            T value(std::forward<Args>(args)...);
+            ::new (static_cast<void*>(_data + _size)) T(std::move(_data[_size - 1]));
+            ++_size;
+            std::move_backward(_data + index, _data + _size - 2, _data + _size - 1);
+            _data[index] = std::move(value);
+        }
+        return _data + index;
+    }
+
+    iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        auto const index = static_cast<size_type>(first - _data);
+        auto const n     = static_cast<size_type>(last - first);
+        if (n != 0) {
+            std::move(_data + index + n, _data + _size, _data + index);
+            std::destroy_n(_data + _size - n, n);
+            _size -= n;
+        }
+        return _data + index;
+    }
+
+    void push_back(value_type const& value) { emplace_back(value); }
+
+    void push_back(value_type&& value) { emplace_back(std::move(value)); }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args) {
+        return *emplace(end(), std::forward<Args>(args)...);
+    }
+
+    void pop_back() { erase(end() - 1); }
+
+    void resize(size_type count) {
+        if (count < _size) {
+            erase(begin() + count, end());
+        } else {
+            _append(count - _size, [n = count - _size](T* dst) {
+                std::uninitialized_value_construct_n(dst, n);
+            });
+        }
+    }
+
+    void resize(size_type count, value_type const& value) {
+        if (count < _size) {
+            erase(begin() + count, end());
+        } else {
+            insert(end(), count - _size, value);
+        }
+    }
+
+    void swap(small_vector& other) noexcept(
+        std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>
+    ) {
+        using std::swap;
+        if (!_is_inline() && !other._is_inline()) {
+            if constexpr (_alloc_traits::propagate_on_container_swap::value) {
+                swap(_alloc(), other._alloc());
+            }
+            swap(_data, other._data);
+            swap(_size, other._size);
+            swap(_capacity, other._capacity);
+        } else {
+            small_vector tmp(std::move(other));
+            other = std::move(*this);
+            *this = std::move(tmp);
+        }
+    }
+};
+
+template <typename T, std::size_t N, typename Allocator>
+bool operator==(
+    small_vector<T, N, Allocator> const& lhs, small_vector<T, N, Allocator> const& rhs
+) {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+#ifndef FLAT_MAP_HAS_THREE_WAY_COMPARISON
+template <typename T, std::size_t N, typename Allocator>
+bool operator!=(
+    small_vector<T, N, Allocator> const& lhs, small_vector<T, N, Allocator> const& rhs
+) {
+    return !(lhs == rhs);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+bool operator<(small_vector<T, N, Allocator> const& lhs, small_vector<T, N, Allocator> const& rhs) {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename T, std::size_t N, typename Allocator>
+bool operator<=(
+    small_vector<T, N, Allocator> const& lhs, small_vector<T, N, Allocator> const& rhs
+) {
+    return !(rhs < lhs);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+bool operator>(small_vector<T, N, Allocator> const& lhs, small_vector<T, N, Allocator> const& rhs) {
+    return rhs < lhs;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+bool operator>=(
+    small_vector<T, N, Allocator> const& lhs, small_vector<T, N, Allocator> const& rhs
+) {
+    return !(lhs < rhs);
+}
+#else
+template <typename T, std::size_t N, typename Allocator>
+auto operator<=>(
+    small_vector<T, N, Allocator> const& lhs, small_vector<T, N, Allocator> const& rhs
+) {
+    return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+#endif
+
+template <typename T, std::size_t N, typename Allocator>
+void swap(small_vector<T, N, Allocator>& lhs, small_vector<T, N, Allocator>& rhs) noexcept(
+    noexcept(lhs.swap(rhs))
+) {
+    lhs.swap(rhs);
+}
+
+}  // namespace flat_map
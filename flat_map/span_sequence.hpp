@@ -0,0 +1,68 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace flat_map {
+
+// Read-only sequence over an externally owned contiguous array, which never allocates.
+template <typename T>
+class span_sequence {
+    T const*    _data = nullptr;
+    std::size_t _size = 0;
+
+   public:
+    using value_type = T;
+    // Only for the requirements of the underlying container, span_sequence never allocates.
+    using allocator_type         = std::allocator<T>;
+    using size_type              = std::size_t;
+    using difference_type        = std::ptrdiff_t;
+    using reference              = T const&;
+    using const_reference        = T const&;
+    using pointer                = T const*;
+    using const_pointer          = T const*;
+    using iterator               = T const*;
+    using const_iterator         = T const*;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    constexpr span_sequence() noexcept = default;
+
+    constexpr span_sequence(T const* data, size_type size) noexcept : _data{data}, _size{size} {}
+
+    template <
+        typename Contiguous,
+        typename = std::enable_if_t<
+            std::is_convertible_v<decltype(std::declval<Contiguous const&>().data()), T const*>>>
+    constexpr explicit span_sequence(Contiguous const& cont) noexcept
+        : _data{cont.data()}, _size{cont.size()} {}
+
+    constexpr const_iterator         begin() const noexcept { return _data; }
+    constexpr const_iterator         cbegin() const noexcept { return _data; }
+    constexpr const_iterator         end() const noexcept { return _data + _size; }
+    constexpr const_iterator         cend() const noexcept { return _data + _size; }
+    constexpr const_reverse_iterator rbegin() const noexcept { return reverse_iterator{end()}; }
+    constexpr const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+    constexpr const_reverse_iterator rend() const noexcept { return reverse_iterator{begin()}; }
+    constexpr const_reverse_iterator crend() const noexcept { return rend(); }
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return _size == 0; }
+    constexpr size_type          size() const noexcept { return _size; }
+    constexpr size_type          max_size() const noexcept {
+        return std::numeric_limits<difference_type>::max() / sizeof(T);
+    }
+
+    constexpr const_reference operator[](size_type pos) const noexcept { return _data[pos]; }
+    constexpr const_reference front() const noexcept { return _data[0]; }
+    constexpr const_reference back() const noexcept { return _data[_size - 1]; }
+    constexpr const_pointer   data() const noexcept { return _data; }
+};
+
+}  // namespace flat_map
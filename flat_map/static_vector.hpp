@@ -0,0 +1,429 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "flat_map/__config.hpp"
+#include "flat_map/__memory.hpp"
+
+namespace flat_map {
+
+// Contiguous sequence which holds up to N elements in itself and never allocates.
+// Growing beyond N throws std::length_error, so callers which must not throw check full() first.
+// Since C++20, it is usable in constant evaluation. Erasure doesn't end the lifetime of trivially
+// destructible elements, so that a constexpr variable holding all N elements once is valid.
+template <typename T, std::size_t N>
+class static_vector {
+    static_assert(N > 0, "static_vector should hold at least one element");
+
+   public:
+    using value_type             = T;
+    using allocator_type         = std::allocator<T>;
+    using size_type              = std::size_t;
+    using difference_type        = std::ptrdiff_t;
+    using reference              = T&;
+    using const_reference        = T const&;
+    using pointer                = T*;
+    using const_pointer          = T const*;
+    using iterator               = T*;
+    using const_iterator         = T const*;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr size_type static_capacity = N;
+
+   private:
+    size_type _size = 0;
+    union {
+        T _elements[N];
+    };
+
+    static constexpr void _check_capacity(size_type required) {
+        if (required > N) {
+            throw std::length_error{"static_vector"};
+        }
+    }
+
+    static constexpr void _destroy(T* first, T* last) noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            std::destroy(first, last);
+        }
+    }
+
+    // Constructs elements from [first, last) at out, like std::uninitialized_copy.
+    template <typename InputIterator>
+    static FLAT_MAP_CONSTEXPR20 void _construct(InputIterator first, InputIterator last, T* out) {
+        auto const begin = out;
+        try {
+            for (; first != last; ++first, ++out) {
+                detail::construct_at(out, *first);
+            }
+        } catch (...) {
+            _destroy(begin, out);
+            throw;
+        }
+    }
+
+    // Moves the elements appended after old_size to index.
+    constexpr iterator _rotate_to(size_type index, size_type old_size) {
+        std::rotate(data() + index, data() + old_size, end());
+        return data() + index;
+    }
+
+    template <typename InputIterator>
+    FLAT_MAP_CONSTEXPR20 iterator _insert(
+        size_type index, InputIterator first, InputIterator last, std::input_iterator_tag
+    ) {
+        auto const old_size = _size;
+        try {
+            for (; first != last; ++first) {
+                emplace_back(*first);
+            }
+        } catch (...) {
+            erase(begin() + old_size, end());
+            throw;
+        }
+        return _rotate_to(index, old_size);
+    }
+
+    template <typename ForwardIterator>
+    constexpr iterator _insert(
+        size_type index, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag
+    ) {
+        auto const n = static_cast<size_type>(std::distance(first, last));
+        _check_capacity(_size + n);
+        auto const old_size = _size;
+        _construct(first, last, end());
+        _size += n;
+        return _rotate_to(index, old_size);
+    }
+
+    template <typename InputIterator>
+    constexpr void _append_range(InputIterator first, InputIterator last) {
+        _insert(
+            _size,
+            first,
+            last,
+            typename std::iterator_traits<InputIterator>::iterator_category{}
+        );
+    }
+
+   public:
+    constexpr static_vector() noexcept {}
+
+    constexpr explicit static_vector(allocator_type const&) noexcept {}
+
+    constexpr explicit static_vector(size_type count, allocator_type const& = allocator_type()) {
+        resize(count);
+    }
+
+    constexpr static_vector(
+        size_type count, value_type const& value, allocator_type const& = allocator_type()
+    ) {
+        resize(count, value);
+    }
+
+    template <
+        typename InputIterator,
+        typename = typename std::iterator_traits<InputIterator>::iterator_category>
+    constexpr static_vector(
+        InputIterator first, InputIterator last, allocator_type const& = allocator_type()
+    ) {
+        _append_range(first, last);
+    }
+
+    constexpr static_vector(
+        std::initializer_list<value_type> init, allocator_type const& = allocator_type()
+    ) {
+        _append_range(init.begin(), init.end());
+    }
+
+    constexpr static_vector(static_vector const& other) {
+        _append_range(other.begin(), other.end());
+    }
+
+    constexpr static_vector(static_vector const& other, allocator_type const&)
+        : static_vector(other) {}
+
+    constexpr static_vector(static_vector&& other) noexcept(
+        std::is_nothrow_move_constructible_v<T>
+    ) {
+        _construct(
+            std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()), data()
+        );
+        _size = other._size;
+        other.clear();
+    }
+
+    constexpr static_vector(static_vector&& other, allocator_type const&) noexcept(
+        std::is_nothrow_move_constructible_v<T>
+    )
+        : static_vector(std::move(other)) {}
+
+    FLAT_MAP_CONSTEXPR20 ~static_vector() { clear(); }
+
+    constexpr static_vector& operator=(static_vector const& other) {
+        if (this != &other) {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    constexpr static_vector& operator=(static_vector&& other) noexcept(
+        std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>
+    ) {
+        if (this != &other) {
+            assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+            other.clear();
+        }
+        return *this;
+    }
+
+    constexpr static_vector& operator=(std::initializer_list<value_type> ilist) {
+        assign(ilist);
+        return *this;
+    }
+
+    constexpr void assign(size_type count, value_type const& value) {
+        _check_capacity(count);
+        value_type tmp(value);
+        clear();
+        resize(count, tmp);
+    }
+
+    template <
+        typename InputIterator,
+        typename = typename std::iterator_traits<InputIterator>::iterator_category>
+    constexpr void assign(InputIterator first, InputIterator last) {
+        clear();
+        _append_range(first, last);
+    }
+
+    constexpr void assign(std::initializer_list<value_type> ilist) {
+        assign(ilist.begin(), ilist.end());
+    }
+
+    constexpr allocator_type get_allocator() const noexcept { return allocator_type(); }
+
+    constexpr reference at(size_type pos) {
+        if (pos >= _size) {
+            throw std::out_of_range{"static_vector"};
+        }
+        return data()[pos];
+    }
+
+    constexpr const_reference at(size_type pos) const {
+        return const_cast<static_vector*>(this)->at(pos);
+    }
+
+    constexpr reference       operator[](size_type pos) noexcept { return data()[pos]; }
+    constexpr const_reference operator[](size_type pos) const noexcept { return data()[pos]; }
+
+    constexpr reference       front() noexcept { return data()[0]; }
+    constexpr const_reference front() const noexcept { return data()[0]; }
+    constexpr reference       back() noexcept { return data()[_size - 1]; }
+    constexpr const_reference back() const noexcept { return data()[_size - 1]; }
+
+    constexpr T*       data() noexcept { return _elements; }
+    constexpr T const* data() const noexcept { return _elements; }
+
+    constexpr iterator       begin() noexcept { return data(); }
+    constexpr const_iterator begin() const noexcept { return data(); }
+    constexpr const_iterator cbegin() const noexcept { return begin(); }
+    constexpr iterator       end() noexcept { return data() + _size; }
+    constexpr const_iterator end() const noexcept { return data() + _size; }
+    constexpr const_iterator cend() const noexcept { return end(); }
+
+    constexpr reverse_iterator rbegin() noexcept { return reverse_iterator{end()}; }
+    constexpr const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator{end()};
+    }
+    constexpr const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+    constexpr reverse_iterator       rend() noexcept { return reverse_iterator{begin()}; }
+    constexpr const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator{begin()};
+    }
+    constexpr const_reverse_iterator crend() const noexcept { return rend(); }
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return _size == 0; }
+    // extension
+    [[nodiscard]] constexpr bool full() const noexcept { return _size == N; }
+    constexpr size_type          size() const noexcept { return _size; }
+    constexpr size_type          max_size() const noexcept { return N; }
+
+    constexpr void reserve(size_type new_cap) { _check_capacity(new_cap); }
+
+    constexpr size_type capacity() const noexcept { return N; }
+
+    constexpr void shrink_to_fit() noexcept {}
+
+    constexpr void clear() noexcept {
+        _destroy(begin(), end());
+        _size = 0;
+    }
+
+    constexpr iterator insert(const_iterator pos, value_type const& value) {
+        return emplace(pos, value);
+    }
+
+    constexpr iterator insert(const_iterator pos, value_type&& value) {
+        return emplace(pos, std::move(value));
+    }
+
+    constexpr iterator insert(const_iterator pos, size_type count, value_type const& value) {
+        _check_capacity(_size + count);
+        auto const index    = static_cast<size_type>(pos - data());
+        auto const old_size = _size;
+        value_type tmp(value);
+        for (; _size != old_size + count; ++_size) {
+            detail::construct_at(end(), tmp);
+        }
+        return _rotate_to(index, old_size);
+    }
+
+    template <
+        typename InputIterator,
+        typename = typename std::iterator_traits<InputIterator>::iterator_category>
+    constexpr iterator insert(const_iterator pos, InputIterator first, InputIterator last) {
+        return _insert(
+            static_cast<size_type>(pos - data()),
+            first,
+            last,
+            typename std::iterator_traits<InputIterator>::iterator_category{}
+        );
+    }
+
+    constexpr iterator insert(const_iterator pos, std::initializer_list<value_type> ilist) {
+        return insert(pos, ilist.begin(), ilist.end());
+    }
+
+    template <typename... Args>
+    constexpr iterator emplace(const_iterator pos, Args&&... args) {
+        _check_capacity(_size + 1);
+        auto const index = static_cast<size_type>(pos - data());
+        if (index == _size) {
+            detail::construct_at(end(), std::forward<Args>(args)...);
+            ++_size;
+        } else {
+            // Constructs the value first, as args may refer an element which is moved.
+            T value(std::forward<Args>(args)...);
+            detail::construct_at(end(), std::move(back()));
+            ++_size;
+            std::move_backward(begin() + index, end() - 2, end() - 1);
+            data()[index] = std::move(value);
+        }
+        return begin() + index;
+    }
+
+    constexpr iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+    constexpr iterator erase(const_iterator first, const_iterator last) {
+        auto const index = static_cast<size_type>(first - data());
+        auto const n     = static_cast<size_type>(last - first);
+        if (n != 0) {
+            std::move(begin() + index + n, end(), begin() + index);
+            _destroy(end() - n, end());
+            _size -= n;
+        }
+        return begin() + index;
+    }
+
+    constexpr void push_back(value_type const& value) { emplace_back(value); }
+
+    constexpr void push_back(value_type&& value) { emplace_back(std::move(value)); }
+
+    template <typename... Args>
+    constexpr reference emplace_back(Args&&... args) {
+        return *emplace(end(), std::forward<Args>(args)...);
+    }
+
+    constexpr void pop_back() { erase(end() - 1); }
+
+    constexpr void resize(size_type count) {
+        if (count < _size) {
+            erase(begin() + count, end());
+        } else {
+            _check_capacity(count);
+            for (; _size != count; ++_size) {
+                detail::construct_at(end());
+            }
+        }
+    }
+
+    constexpr void resize(size_type count, value_type const& value) {
+        if (count < _size) {
+            erase(begin() + count, end());
+        } else {
+            insert(end(), count - _size, value);
+        }
+    }
+
+    constexpr void swap(static_vector& other) noexcept(
+        std::is_nothrow_move_constructible_v<T> && std::is_nothrow_swappable_v<T>
+    ) {
+        auto&      shorter = _size < other._size ? *this : other;
+        auto&      longer  = _size < other._size ? other : *this;
+        auto const mid     = longer.begin() + shorter._size;
+        std::swap_ranges(shorter.begin(), shorter.end(), longer.begin());
+        _construct(
+            std::make_move_iterator(mid), std::make_move_iterator(longer.end()), shorter.end()
+        );
+        _destroy(mid, longer.end());
+        std::swap(_size, other._size);
+    }
+};
+
+template <typename T, std::size_t N>
+constexpr bool operator==(static_vector<T, N> const& lhs, static_vector<T, N> const& rhs) {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+#ifndef FLAT_MAP_HAS_THREE_WAY_COMPARISON
+template <typename T, std::size_t N>
+constexpr bool operator!=(static_vector<T, N> const& lhs, static_vector<T, N> const& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename T, std::size_t N>
+constexpr bool operator<(static_vector<T, N> const& lhs, static_vector<T, N> const& rhs) {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename T, std::size_t N>
+constexpr bool operator<=(static_vector<T, N> const& lhs, static_vector<T, N> const& rhs) {
+    return !(rhs < lhs);
+}
+
+template <typename T, std::size_t N>
+constexpr bool operator>(static_vector<T, N> const& lhs, static_vector<T, N> const& rhs) {
+    return rhs < lhs;
+}
+
+template <typename T, std::size_t N>
+constexpr bool operator>=(static_vector<T, N> const& lhs, static_vector<T, N> const& rhs) {
+    return !(lhs < rhs);
+}
+#else
+template <typename T, std::size_t N>
+constexpr auto operator<=>(static_vector<T, N> const& lhs, static_vector<T, N> const& rhs) {
+    return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+#endif
+
+template <typename T, std::size_t N>
+constexpr void swap(static_vector<T, N>& lhs, static_vector<T, N>& rhs) noexcept(
+    noexcept(lhs.swap(rhs))
+) {
+    lhs.swap(rhs);
+}
+
+}  // namespace flat_map
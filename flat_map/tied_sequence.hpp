@@ -13,6 +13,7 @@
 #include <type_traits>
 #include <utility>
 
+#include "flat_map/__concepts.hpp"
 #include "flat_map/__config.hpp"
 #include "flat_map/__memory.hpp"
 #include "flat_map/__tuple.hpp"
@@ -371,6 +372,15 @@ class tied_sequence {
     using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
    private:
+    // Appends elements of single-pass range to the end of each sequence, so that they grow
+    // geometrically without materializing the range.
+    template <typename InputIterator>
+    constexpr void _append(InputIterator first, InputIterator last) {
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+
     template <std::size_t... N>
     constexpr tied_sequence(std::index_sequence<N...>, allocator_type const& alloc)
         : _seq{alloc.template get<N>()...} {}
@@ -422,12 +432,12 @@ class tied_sequence {
     constexpr tied_sequence(
         std::index_sequence<N...>,
         std::input_iterator_tag,
-        InputIterator,
-        InputIterator,
-        typename Sequences::allocator_type const&...
-    ) {
-        // TODO
-        static_assert(sizeof(InputIterator) && false, "not implemented yet");
+        InputIterator                              first,
+        InputIterator                              last,
+        typename Sequences::allocator_type const&... alloc
+    )
+        : _seq{alloc...} {
+        _append(first, last);
     }
 
     template <typename ForwardIterator, std::size_t... N>
@@ -563,10 +573,10 @@ class tied_sequence {
    private:
     template <typename InputIterator, std::size_t... N>
     constexpr void _assign(
-        InputIterator, InputIterator, std::index_sequence<N...>, std::input_iterator_tag
+        InputIterator first, InputIterator last, std::index_sequence<N...>, std::input_iterator_tag
     ) {
-        // TODO
-        static_assert(sizeof(InputIterator) && false, "not implemented yet");
+        clear();
+        _append(first, last);
     }
 
     template <typename ForwardIterator, std::size_t... N>
@@ -664,6 +674,25 @@ class tied_sequence {
         );
     }
 
+    template <bool B = (concepts::Reservable<Sequences> && ...), std::enable_if_t<B, int> = 0>
+    constexpr void reserve(size_type new_cap) {
+        detail::tuple_reduction([new_cap](auto&... c) { (c.reserve(new_cap), ...); }, _seq);
+    }
+
+    // The number of elements which all sequences can hold without reallocation.
+    template <bool B = (concepts::HasCapacity<Sequences> && ...), std::enable_if_t<B, int> = 0>
+    constexpr size_t capacity() const noexcept {
+        return detail::tuple_reduction(
+            [](auto&&... c) { return std::min({c.capacity()...}); },
+            _seq
+        );
+    }
+
+    template <bool B = (concepts::Shrinkable<Sequences> && ...), std::enable_if_t<B, int> = 0>
+    constexpr void shrink_to_fit() {
+        detail::tuple_reduction([](auto&... c) { (c.shrink_to_fit(), ...); }, _seq);
+    }
+
     constexpr void clear() noexcept {
         detail::tuple_reduction([](auto&... c) { (c.clear(), ...); }, _seq);
     }
@@ -698,14 +727,25 @@ class tied_sequence {
    private:
     template <typename InputIterator, std::size_t... N>
     constexpr iterator _insert(
-        const_iterator,
-        InputIterator,
-        InputIterator,
+        const_iterator pos,
+        InputIterator  first,
+        InputIterator  last,
         std::index_sequence<N...>,
         std::input_iterator_tag
     ) {
-        // TODO
-        static_assert(sizeof(InputIterator) && false, "not implemented yet");
+        // The number of elements is unknown until the end, so appends them and then rotates each
+        // sequence once to bring them into place.
+        auto const index    = std::distance(cbegin(), pos);
+        auto const old_size = static_cast<difference_type>(size());
+        _append(first, last);
+        detail::tuple_reduction(
+            [index, old_size](auto&... c) {
+                (std::rotate(std::next(c.begin(), index), std::next(c.begin(), old_size), c.end()),
+                 ...);
+            },
+            _seq
+        );
+        return std::next(begin(), index);
     }
 
     template <typename ForwardIterator, std::size_t... N>
@@ -806,6 +846,18 @@ class tied_sequence {
         detail::tuple_reduction([](auto&... c) { (c.pop_back(), ...); }, _seq);
     }
 
+    constexpr void resize(size_type count) {
+        detail::tuple_reduction([count](auto&... c) { (c.resize(count), ...); }, _seq);
+    }
+
+    constexpr void resize(size_type count, value_type const& value) {
+        detail::tuple_transform(
+            [count](auto& c, auto& value) { c.resize(count, value); },
+            _seq,
+            value
+        );
+    }
+
     constexpr void swap(tied_sequence& other) noexcept(
         ((std::allocator_traits<
               typename Sequences::allocator_type>::propagate_on_container_swap::value
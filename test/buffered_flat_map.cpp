@@ -0,0 +1,135 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <iterator>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "flat_map/buffered_flat_map.hpp"
+#include "flat_map/tied_sequence.hpp"
+
+template <typename Buffered, typename Std>
+static void check_equal(Buffered const& b, Std const& s) {
+    REQUIRE(b.size() == s.size());
+    REQUIRE(static_cast<std::size_t>(std::distance(b.begin(), b.end())) == s.size());
+    auto itr = s.begin();
+    for (auto const& [k, v] : b) {
+        REQUIRE(k == itr->first);
+        REQUIRE(v == itr->second);
+        ++itr;
+    }
+}
+
+template <typename Buffered>
+static void random_operations() {
+    std::mt19937       rng{};
+    Buffered           b{typename Buffered::flat_type{}, 16};
+    std::map<int, int> s;
+
+    for (int i = 0; i < 2000; ++i) {
+        auto const key = std::uniform_int_distribution<int>{0, 200}(rng);
+        switch (std::uniform_int_distribution<int>{0, 3}(rng)) {
+            case 0: {
+                auto [itr, inserted] = b.insert({key, i});
+                REQUIRE(inserted == s.insert({key, i}).second);
+                REQUIRE(std::get<0>(*itr) == key);
+                REQUIRE(std::get<1>(*itr) == s[key]);
+                break;
+            }
+            case 1:
+                REQUIRE(b.erase(key) == s.erase(key));
+                break;
+            case 2:
+                b[key] = i;
+                s[key] = i;
+                break;
+            case 3:
+                REQUIRE(b.insert_or_assign(key, -i).second == s.insert_or_assign(key, -i).second);
+                break;
+        }
+        REQUIRE(b.buffer_size() <= b.buffer_limit());
+        REQUIRE(b.contains(key) == (s.count(key) != 0));
+        REQUIRE(b.count(key) == s.count(key));
+    }
+    check_equal(b, s);
+
+    for (int key = -1; key < 202; ++key) {
+        auto itr = b.lower_bound(key);
+        auto ref = s.lower_bound(key);
+        REQUIRE((itr == b.end()) == (ref == s.end()));
+        if (ref != s.end()) {
+            REQUIRE(std::get<0>(*itr) == ref->first);
+            REQUIRE(std::get<0>(*b.find(ref->first)) == ref->first);
+        } else {
+            REQUIRE(b.find(key) == b.end());
+        }
+    }
+
+    auto flat = std::move(b).extract();
+    REQUIRE(flat.size() == s.size());
+    check_equal(Buffered{std::move(flat)}, s);
+}
+
+TEST_CASE("buffered flat_map", "[buffered_flat_map]") {
+    SECTION("vector") { random_operations<flat_map::buffered_flat_map<int, int>>(); }
+
+    SECTION("tied_sequence") {
+        random_operations<flat_map::buffered_flat_map<
+            int,
+            int,
+            std::less<int>,
+            flat_map::tied_sequence<std::vector<int>, std::vector<int>>>>();
+    }
+
+    SECTION("accessor") {
+        flat_map::buffered_flat_map<int, int> b{flat_map::flat_map<int, int>{{1, 2}, {3, 4}}};
+        b.erase(1);
+        REQUIRE_THROWS_AS(b.at(1), std::out_of_range);
+        b.insert({1, 5});
+        REQUIRE(b.at(1) == 5);
+        REQUIRE(b.at(3) == 4);
+        REQUIRE_FALSE(b.insert({3, 6}).second);
+
+        auto const& cb = b;
+        REQUIRE(cb.find(1) != cb.end());
+        REQUIRE(cb.find(2) == cb.end());
+        REQUIRE(std::distance(cb.begin(), cb.end()) == 2);
+
+        b.flush();
+        REQUIRE(b.buffer_size() == 0);
+        check_equal(b, std::map<int, int>{{1, 5}, {3, 4}});
+    }
+}
+
+TEST_CASE("buffered flat_multimap", "[buffered_flat_map]") {
+    std::mt19937                               rng{};
+    flat_map::buffered_flat_multimap<int, int> b{flat_map::flat_multimap<int, int>{}, 16};
+    std::multimap<int, int>                    s;
+
+    for (int i = 0; i < 2000; ++i) {
+        auto const key = std::uniform_int_distribution<int>{0, 100}(rng);
+        if (std::uniform_int_distribution<int>{0, 2}(rng) != 0) {
+            auto itr = b.insert({key, i});
+            s.insert({key, i});
+            REQUIRE(std::get<0>(*itr) == key);
+            REQUIRE(std::get<1>(*itr) == i);
+        } else {
+            REQUIRE(b.erase(key) == s.erase(key));
+        }
+        REQUIRE(b.count(key) == s.count(key));
+
+        auto [first, last]   = b.equal_range(key);
+        auto [sfirst, slast] = s.equal_range(key);
+        for (; sfirst != slast; ++first, ++sfirst) {
+            REQUIRE(first != last);
+            REQUIRE(std::get<1>(*first) == sfirst->second);
+        }
+        REQUIRE(first == last);
+    }
+    check_equal(b, s);
+    check_equal(std::move(b).extract(), s);
+}
@@ -0,0 +1,257 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "flat_map/columnar_sequence.hpp"
+#include "test_case/catch2_tuple.hpp"
+
+namespace {
+
+template <typename Seq>
+std::vector<typename Seq::value_type> to_vector(Seq const& seq) {
+    return {seq.begin(), seq.end()};
+}
+
+// Throws on copy of the value 13.
+struct thrower {
+    int value;
+
+    thrower(int value) : value{value} {}
+    thrower(thrower const& other) : value{other.value} {
+        if (value == 13) {
+            throw std::runtime_error{"thirteen"};
+        }
+    }
+    thrower& operator=(thrower const&) = default;
+
+    bool operator==(thrower const& other) const { return value == other.value; }
+};
+
+}  // namespace
+
+TEST_CASE("columnar construction", "[construction]") {
+    using seq_t = flat_map::columnar_sequence<int, char>;
+
+    SECTION("default") {
+        seq_t seq;
+        REQUIRE(seq.empty());
+        REQUIRE(seq.capacity() == 0);
+    }
+
+    SECTION("count") {
+        seq_t seq(3, {1, 'a'});
+        REQUIRE(to_vector(seq) == std::vector<std::tuple<int, char>>{{1, 'a'}, {1, 'a'}, {1, 'a'}});
+
+        seq_t zeros(2);
+        REQUIRE(to_vector(zeros) == std::vector<std::tuple<int, char>>{{0, 0}, {0, 0}});
+    }
+
+    SECTION("initializer list") {
+        seq_t seq{{1, 'a'}, {2, 'b'}};
+        REQUIRE(seq.size() == 2);
+        REQUIRE(seq[0] == std::tuple{1, 'a'});
+        REQUIRE(seq.at(1) == std::tuple{2, 'b'});
+        REQUIRE_THROWS_AS(seq.at(2), std::out_of_range);
+    }
+
+    SECTION("input iterator") {
+        std::istringstream               is{"3 1 4 1 5"};
+        flat_map::columnar_sequence<int> seq{std::istream_iterator<int>{is}, {}};
+        REQUIRE(seq.size() == 5);
+        REQUIRE(std::get<0>(seq[2]) == 4);
+    }
+
+    SECTION("copy and move") {
+        seq_t const seq{{1, 'a'}, {2, 'b'}};
+        seq_t       copy = seq;
+        REQUIRE(copy == seq);
+
+        seq_t moved = std::move(copy);
+        REQUIRE(moved == seq);
+        REQUIRE(copy.empty());
+
+        copy = moved;
+        REQUIRE(copy == seq);
+    }
+}
+
+TEST_CASE("columnar layout", "[layout]") {
+    flat_map::columnar_sequence<std::uint64_t, char, std::uint32_t> seq;
+    for (std::uint64_t i = 0; i < 100; ++i) {
+        seq.emplace_back(i, char('a' + i % 26), std::uint32_t(i * 2));
+    }
+
+    auto const keys   = seq.get_sequence<0>().data();
+    auto const chars  = flat_map::get_sequence<1>(seq).data();
+    auto const values = flat_map::get_sequence<2>(seq).data();
+
+    SECTION("each column is contiguous and aligned to a cache line") {
+        REQUIRE(reinterpret_cast<std::uintptr_t>(keys) % 64 == 0);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(chars) % 64 == 0);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(values) % 64 == 0);
+        for (std::uint64_t i = 0; i < 100; ++i) {
+            REQUIRE(keys[i] == i);
+            REQUIRE(chars[i] == char('a' + i % 26));
+            REQUIRE(values[i] == i * 2);
+        }
+    }
+
+    SECTION("columns are consecutive regions of one allocation") {
+        auto const capacity = seq.capacity();
+        REQUIRE(
+            reinterpret_cast<char const*>(chars)
+            == reinterpret_cast<char const*>(keys) + (capacity * 8 + 63) / 64 * 64
+        );
+        REQUIRE(
+            reinterpret_cast<char const*>(values)
+            == reinterpret_cast<char const*>(chars) + (capacity + 63) / 64 * 64
+        );
+    }
+}
+
+TEST_CASE("columnar capacity", "[capacity]") {
+    flat_map::columnar_sequence<int, std::string> seq{{1, "one"}, {2, "two"}};
+
+    seq.reserve(100);
+    REQUIRE(seq.capacity() == 100);
+    REQUIRE(seq.size() == 2);
+    REQUIRE(seq[1] == std::tuple{2, std::string("two")});
+
+    seq.shrink_to_fit();
+    REQUIRE(seq.capacity() == 2);
+    REQUIRE(seq[0] == std::tuple{1, std::string("one")});
+
+    seq.push_back({3, "three"});
+    REQUIRE(seq.capacity() == 4);
+    REQUIRE(seq.max_size() > 0);
+
+    seq.clear();
+    REQUIRE(seq.empty());
+    REQUIRE(seq.capacity() == 4);
+}
+
+TEST_CASE("columnar modifiers", "[modifiers]") {
+    using seq_t = flat_map::columnar_sequence<int, std::string>;
+    using vec_t = std::vector<std::tuple<int, std::string>>;
+
+    seq_t seq{{0, "a"}, {2, "c"}, {4, "e"}};
+
+    SECTION("insert") {
+        auto itr = seq.insert(std::next(seq.begin()), {1, "b"});
+        REQUIRE(itr == std::next(seq.begin()));
+        REQUIRE(to_vector(seq) == vec_t{{0, "a"}, {1, "b"}, {2, "c"}, {4, "e"}});
+
+        // Without reallocation.
+        seq.reserve(10);
+        itr = seq.insert(std::prev(seq.end()), {3, "d"});
+        REQUIRE(itr == std::prev(seq.end(), 2));
+        REQUIRE(to_vector(seq) == vec_t{{0, "a"}, {1, "b"}, {2, "c"}, {3, "d"}, {4, "e"}});
+
+        auto const value = std::tuple{5, std::string("f")};
+        seq.insert(seq.end(), value);
+        REQUIRE(seq.back() == value);
+    }
+
+    SECTION("insert count") {
+        auto itr = seq.insert(std::next(seq.begin()), 2, {1, "b"});
+        REQUIRE(itr == std::next(seq.begin()));
+        REQUIRE(to_vector(seq) == vec_t{{0, "a"}, {1, "b"}, {1, "b"}, {2, "c"}, {4, "e"}});
+    }
+
+    SECTION("insert range") {
+        vec_t const range{{1, "b"}, {3, "d"}};
+        auto        itr = seq.insert(std::next(seq.begin()), range.begin(), range.end());
+        REQUIRE(itr == std::next(seq.begin()));
+        REQUIRE(to_vector(seq) == vec_t{{0, "a"}, {1, "b"}, {3, "d"}, {2, "c"}, {4, "e"}});
+
+        seq.insert(seq.begin(), {{-2, "y"}, {-1, "z"}});
+        REQUIRE(seq.size() == 7);
+        REQUIRE(seq.front() == std::tuple{-2, std::string("y")});
+    }
+
+    SECTION("emplace") {
+        seq.emplace(seq.begin(), -1, "z");
+        seq.emplace(
+            std::next(seq.begin(), 2),
+            std::piecewise_construct,
+            std::forward_as_tuple(1),
+            std::forward_as_tuple(3, 'b')
+        );
+        REQUIRE(to_vector(seq) == vec_t{{-1, "z"}, {0, "a"}, {1, "bbb"}, {2, "c"}, {4, "e"}});
+    }
+
+    SECTION("erase") {
+        auto itr = seq.erase(seq.begin());
+        REQUIRE(itr == seq.begin());
+        REQUIRE(to_vector(seq) == vec_t{{2, "c"}, {4, "e"}});
+
+        itr = seq.erase(seq.begin(), seq.end());
+        REQUIRE(itr == seq.end());
+        REQUIRE(seq.empty());
+    }
+
+    SECTION("push_back and pop_back") {
+        seq.push_back({5, "f"});
+        seq.emplace_back(6, "g");
+        REQUIRE(seq.size() == 5);
+        REQUIRE(seq.back() == std::tuple{6, std::string("g")});
+
+        seq.pop_back();
+        REQUIRE(seq.back() == std::tuple{5, std::string("f")});
+    }
+
+    SECTION("resize") {
+        seq.resize(5);
+        REQUIRE(to_vector(seq) == vec_t{{0, "a"}, {2, "c"}, {4, "e"}, {0, ""}, {0, ""}});
+
+        seq.resize(6, {9, "z"});
+        REQUIRE(seq.back() == std::tuple{9, std::string("z")});
+
+        seq.resize(1);
+        REQUIRE(to_vector(seq) == vec_t{{0, "a"}});
+    }
+
+    SECTION("assign") {
+        seq.assign(2, {7, "x"});
+        REQUIRE(to_vector(seq) == vec_t{{7, "x"}, {7, "x"}});
+
+        seq = {{1, "p"}};
+        REQUIRE(to_vector(seq) == vec_t{{1, "p"}});
+    }
+
+    SECTION("swap") {
+        seq_t other{{9, "z"}};
+        swap(seq, other);
+        REQUIRE(to_vector(seq) == vec_t{{9, "z"}});
+        REQUIRE(other.size() == 3);
+    }
+}
+
+TEST_CASE("columnar exception safety", "[exception]") {
+    using seq_t = flat_map::columnar_sequence<std::string, thrower>;
+
+    seq_t seq{{"a", 1}, {"b", 2}};
+    seq.shrink_to_fit();
+    auto const before = to_vector(seq);
+
+    SECTION("on reallocation") {
+        REQUIRE_THROWS_AS(seq.emplace_back("c", 13), std::runtime_error);
+        REQUIRE(to_vector(seq) == before);
+        REQUIRE(seq.capacity() == 2);
+    }
+
+    SECTION("on append") {
+        REQUIRE_THROWS_AS(seq.resize(3, {"c", 13}), std::runtime_error);
+        seq.reserve(10);
+        REQUIRE_THROWS_AS(seq.insert(seq.end(), 3, {"c", 13}), std::runtime_error);
+        REQUIRE(to_vector(seq) == before);
+    }
+}
@@ -0,0 +1,75 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+#include "flat_map/flat_map.hpp"
+#include "flat_map/flat_set.hpp"
+
+namespace {
+
+using namespace std::string_view_literals;
+
+#if defined(__cpp_constexpr_dynamic_alloc) && defined(__cpp_lib_constexpr_vector)
+constexpr auto table = flat_map::make_static_flat_map<int, std::string_view>({
+    {3, "three"},
+    {1, "one"  },
+    {4, "four" },
+    {1, "uno"  },
+    {5, "five" },
+});
+
+static_assert(table.size() == 4);
+static_assert(table.begin()->second == "one"sv);
+static_assert(table.at(4) == "four"sv);
+static_assert(table.contains(5));
+static_assert(!table.contains(2));
+static_assert(table.find(2) == table.end());
+static_assert(table.lower_bound(2)->first == 3);
+static_assert(table.upper_bound(4)->first == 5);
+
+constexpr auto primes = flat_map::make_static_flat_set({7, 2, 5, 3, 2}, std::greater<int>{});
+
+static_assert(primes.size() == 4);
+static_assert(*primes.begin() == 7);
+static_assert(primes.count(2) == 1);
+static_assert(primes.lower_bound(4) != primes.end() && *primes.lower_bound(4) == 3);
+
+// std::vector backed containers can't outlive constant evaluation, but can be used in it.
+static_assert([] {
+    flat_map::flat_map<int, int> fm{{2, 20}, {1, 10}, {3, 30}};
+    flat_map::flat_set<int>      fs{3, 1, 2, 1};
+    return fm.at(2) == 20 && fs.size() == 3 && fs.contains(1) && !fs.contains(4);
+}());
+
+// Static containers only need room for the result, even if the range is longer.
+static_assert([] {
+    flat_map::static_flat_map<int, int, 2> fm{{2, 20}, {1, 10}, {2, 21}};
+    return fm.size() == 2 && fm.at(1) == 10 && fm.at(2) == 20;
+}());
+#endif
+
+}  // namespace
+
+TEST_CASE("make static flat containers", "[constexpr]") {
+    SECTION("map") {
+        auto const fm = flat_map::make_static_flat_map<int, std::string_view>({
+            {3, "three"},
+            {1, "one"  },
+            {1, "uno"  },
+        });
+        REQUIRE(fm.size() == 2);
+        REQUIRE(fm.capacity() == 3);
+        REQUIRE(fm.at(1) == "one");
+        REQUIRE(fm.at(3) == "three");
+        REQUIRE(std::next(fm.begin())->first == 3);
+    }
+
+    SECTION("set") {
+        auto const fs = flat_map::make_static_flat_set({3, 1, 2, 1}, std::greater<int>{});
+        REQUIRE(std::vector<int>(fs.begin(), fs.end()) == std::vector{3, 2, 1});
+    }
+}
@@ -0,0 +1,150 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <iterator>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "flat_map/flat_map.hpp"
+#include "flat_map/flat_map_view.hpp"
+#include "flat_map/flat_set_view.hpp"
+#include "flat_map/span_sequence.hpp"
+#include "flat_map/tied_sequence.hpp"
+
+template <typename View, typename Std>
+static void check_lookup(View const& view, Std const& s) {
+    REQUIRE(view.size() == s.size());
+    REQUIRE(view.empty() == s.empty());
+    REQUIRE(static_cast<std::size_t>(std::distance(view.begin(), view.end())) == s.size());
+
+    for (int key = -1; key < 42; ++key) {
+        REQUIRE(view.count(key) == s.count(key));
+        REQUIRE(view.contains(key) == (s.count(key) != 0));
+        REQUIRE(std::distance(view.begin(), view.lower_bound(key))
+                == std::distance(s.begin(), s.lower_bound(key)));
+        REQUIRE(std::distance(view.begin(), view.upper_bound(key))
+                == std::distance(s.begin(), s.upper_bound(key)));
+
+        auto [first, last]   = view.equal_range(key);
+        auto [sfirst, slast] = s.equal_range(key);
+        REQUIRE(std::distance(first, last) == std::distance(sfirst, slast));
+
+        auto itr = view.find(key);
+        REQUIRE((itr == view.end()) == (s.find(key) == s.end()));
+    }
+
+    std::vector<int>  keys{40, 3, -1, 7, 21, 3};
+    std::vector<bool> found;
+    view.contains_many(keys.begin(), keys.end(), std::back_inserter(found));
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        REQUIRE(found[i] == (s.count(keys[i]) != 0));
+    }
+}
+
+TEST_CASE("flat_map_view", "[flat_map_view]") {
+    std::map<int, int>               s;
+    std::vector<std::pair<int, int>> pairs;
+    std::vector<int>                 keys, values;
+    for (int i = 0; i < 40; i += 3) {
+        s.emplace(i, i * 10);
+        pairs.emplace_back(i, i * 10);
+        keys.push_back(i);
+        values.push_back(i * 10);
+    }
+
+    SECTION("span of pairs") {
+        flat_map::flat_map_view view{pairs.data(), pairs.size()};
+        check_lookup(view, s);
+        REQUIRE(view.at(9) == 90);
+        REQUIRE_THROWS_AS(view.at(10), std::out_of_range);
+        REQUIRE(&*view.find(12) == &pairs[4]);
+    }
+
+    SECTION("split keys and values") {
+        flat_map::flat_map_view view{keys.data(), values.data(), keys.size()};
+        static_assert(std::is_same_v<
+                      decltype(view.get_container()),
+                      flat_map::tied_sequence<
+                          flat_map::span_sequence<int>,
+                          flat_map::span_sequence<int>> const&>);
+        check_lookup(view, s);
+        REQUIRE(view.at(39) == 390);
+        REQUIRE(&std::get<1>(*view.find(12)) == &values[4]);
+    }
+
+    SECTION("over flat_map") {
+        flat_map::flat_map<int, int> fm{pairs.begin(), pairs.end()};
+        flat_map::flat_map_view<int, int> view{
+            flat_map::span_sequence<std::pair<int, int>>{fm.get_container()}};
+        check_lookup(view, s);
+    }
+
+    SECTION("empty") {
+        flat_map::flat_map_view<int, int> view;
+        check_lookup(view, std::map<int, int>{});
+    }
+}
+
+TEST_CASE("flat_multimap_view", "[flat_map_view]") {
+    std::multimap<int, int> s;
+    std::vector<int>        keys, values;
+    for (int i = 0; i < 40; i += 3) {
+        for (int j = 0; j < i % 4; ++j) {
+            s.emplace(i, j);
+            keys.push_back(i);
+            values.push_back(j);
+        }
+    }
+
+    flat_map::flat_multimap_view view{keys.data(), values.data(), keys.size()};
+    check_lookup(view, s);
+
+    auto [first, last] = view.equal_range(27);
+    REQUIRE(std::distance(first, last) == 3);
+    for (int j = 0; first != last; ++first, ++j) {
+        REQUIRE(std::get<1>(*first) == j);
+    }
+}
+
+TEST_CASE("flat_set_view", "[flat_map_view]") {
+    std::vector<int> keys;
+    for (int i = 0; i < 40; i += 2) {
+        keys.push_back(i);
+    }
+
+    SECTION("set") {
+        flat_map::flat_set_view view{keys.data(), keys.size()};
+        check_lookup(view, std::set<int>(keys.begin(), keys.end()));
+        REQUIRE(view.find(8) == keys.data() + 4);
+    }
+
+    SECTION("multiset") {
+        std::vector<int> dup;
+        for (auto k : keys) {
+            dup.insert(dup.end(), k % 3 + 1, k);
+        }
+        flat_map::flat_multiset_view view{dup.data(), dup.size()};
+        check_lookup(view, std::multiset<int>(dup.begin(), dup.end()));
+    }
+
+    SECTION("greater") {
+        std::reverse(keys.begin(), keys.end());
+        flat_map::flat_set_view view{keys.data(), keys.size(), std::greater<int>{}};
+        check_lookup(view, std::set<int, std::greater<int>>(keys.begin(), keys.end()));
+    }
+
+    SECTION("transparent") {
+        std::vector<std::string> names{"alice", "bob", "carol"};
+        flat_map::flat_set_view<std::string, std::less<>> view{names.data(), names.size()};
+        REQUIRE(view.contains("bob"));
+        REQUIRE(view.find("dave") == view.end());
+        REQUIRE(view.lower_bound("b") == names.data() + 1);
+    }
+}
@@ -0,0 +1,103 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "flat_map/flat_map.hpp"
+#include "flat_map/flat_multimap.hpp"
+#include "flat_map/flat_set.hpp"
+#include "flat_map/frozen_flat_map.hpp"
+
+namespace {
+
+struct string_hash {
+    using is_transparent = void;
+
+    std::size_t operator()(std::string_view s) const { return std::hash<std::string_view>{}(s); }
+};
+
+// Sends every key to the same bucket, so that lookups fall back to binary search.
+struct constant_hash {
+    std::size_t operator()(int) const { return 42; }
+};
+
+}  // namespace
+
+TEST_CASE("frozen_flat_map lookup", "[frozen_flat_map]") {
+    SECTION("string keys") {
+        flat_map::flat_map<std::string, int> fm;
+        for (int i = 0; i < 1000; ++i) {
+            fm.emplace("key" + std::to_string(i), i);
+        }
+        flat_map::frozen_flat_map frozen{fm};
+        REQUIRE(frozen.size() == 1000);
+        REQUIRE(std::equal(frozen.begin(), frozen.end(), fm.begin(), fm.end()));
+
+        for (int i = 0; i < 1000; ++i) {
+            auto const itr = frozen.find("key" + std::to_string(i));
+            REQUIRE(itr != frozen.end());
+            REQUIRE(itr->second == i);
+        }
+        REQUIRE(frozen.find("key1000") == frozen.end());
+        REQUIRE_FALSE(frozen.contains(""));
+        REQUIRE(frozen.count("key1") == 1);
+        REQUIRE(frozen.lower_bound("key10")->first == "key10");
+        REQUIRE(frozen.upper_bound("key10")->first == "key100");
+        REQUIRE(frozen.equal_range("key5").first->second == 5);
+    }
+
+    SECTION("transparent") {
+        flat_map::flat_map<std::string, int, std::less<>> fm{{"accept", 1}, {"host", 2}};
+        flat_map::frozen_flat_map<decltype(fm), string_hash, std::equal_to<>> const frozen{fm};
+        REQUIRE(frozen.find(std::string_view{"host"})->second == 2);
+        REQUIRE(frozen.contains("accept"));
+        REQUIRE_FALSE(frozen.contains("cookie"));
+    }
+
+    SECTION("set") {
+        flat_map::flat_set<int> fs;
+        for (int i = 0; i < 100; ++i) {
+            fs.insert(i * 7);
+        }
+        flat_map::frozen_flat_map const frozen{fs};
+        for (int i = 0; i < 700; ++i) {
+            REQUIRE(frozen.contains(i) == (i % 7 == 0));
+        }
+    }
+
+    SECTION("empty") {
+        flat_map::frozen_flat_map const frozen{flat_map::flat_set<int>{}};
+        REQUIRE(frozen.empty());
+        REQUIRE(frozen.find(0) == frozen.end());
+    }
+
+    SECTION("same hash") {
+        flat_map::frozen_flat_map<flat_map::flat_set<int>, constant_hash> const frozen{
+            flat_map::flat_set<int>{3, 1, 4, 5, 9}
+        };
+        REQUIRE(*frozen.find(4) == 4);
+        REQUIRE(frozen.find(2) == frozen.end());
+    }
+
+    SECTION("multimap") {
+        flat_map::flat_multimap<int, int> fm{{1, 10}, {2, 20}, {2, 21}, {2, 22}, {3, 30}};
+        flat_map::frozen_flat_map const   frozen{fm};
+        REQUIRE(frozen.find(2) == std::next(frozen.begin()));
+        REQUIRE(frozen.count(2) == 3);
+    }
+}
+
+TEST_CASE("frozen_flat_map extract", "[frozen_flat_map]") {
+    flat_map::frozen_flat_map frozen{flat_map::flat_map<int, int>{{2, 20}, {1, 10}}};
+
+    auto fm = std::move(frozen).extract();
+    REQUIRE(frozen.empty());
+    REQUIRE_FALSE(frozen.contains(1));
+    REQUIRE(fm == flat_map::flat_map<int, int>{{1, 10}, {2, 20}});
+}
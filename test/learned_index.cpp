@@ -0,0 +1,114 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "flat_map/flat_map.hpp"
+#include "flat_map/flat_multiset.hpp"
+#include "flat_map/flat_set.hpp"
+#include "flat_map/learned_index.hpp"
+
+namespace {
+
+// Compares every lookup of index with the one of the underlying container at keys around each
+// element, including ones between and outside of them.
+template <typename Index, typename Flat>
+void require_same_lookup(Index const& index, Flat const& flat) {
+    REQUIRE(std::equal(index.begin(), index.end(), flat.begin(), flat.end()));
+    std::vector<typename Flat::key_type> queries;
+    for (auto const& value : flat) {
+        auto const key = flat_map::detail::key_of<typename Flat::key_type>(value);
+        queries.insert(queries.end(), {key - 1, key, key + 1});
+    }
+    for (auto const key : queries) {
+        auto const offset = [](auto const& c, auto itr) { return std::distance(c.begin(), itr); };
+        REQUIRE(offset(index, index.lower_bound(key)) == offset(flat, flat.lower_bound(key)));
+        REQUIRE(offset(index, index.upper_bound(key)) == offset(flat, flat.upper_bound(key)));
+        REQUIRE(offset(index, index.find(key)) == offset(flat, flat.find(key)));
+        REQUIRE(index.count(key) == flat.count(key));
+    }
+}
+
+}  // namespace
+
+TEST_CASE("learned_index lookup", "[learned_index]") {
+    std::mt19937 rng{};
+
+    SECTION("uniform") {
+        std::vector<std::uint64_t> keys(10000);
+        for (auto& key : keys) {
+            key = rng() % 1000000;
+        }
+        flat_map::flat_set<std::uint64_t> const fs(keys.begin(), keys.end());
+        flat_map::learned_index const          index{fs, 8};
+        REQUIRE(index.epsilon() == 8);
+        REQUIRE(index.segment_count() < fs.size() / 8);
+        require_same_lookup(index, fs);
+    }
+
+    SECTION("clustered") {
+        flat_map::flat_map<int, int> fm;
+        for (int c = 0; c < 10; ++c) {
+            for (int i = 0; i < 100; ++i) {
+                fm.emplace(c * 1000000 + i * (c + 1), i);
+            }
+        }
+        flat_map::learned_index const index{fm, 4};
+        require_same_lookup(index, fm);
+        REQUIRE(index.find(3000004)->second == 1);
+    }
+
+    SECTION("duplicates") {
+        flat_map::flat_multiset<int> fs;
+        for (int i = 0; i < 1000; ++i) {
+            fs.insert(i % 10 == 0 ? 0 : i);
+        }
+        flat_map::learned_index const index{fs, 2};
+        require_same_lookup(index, fs);
+        REQUIRE(index.count(0) == 100);
+    }
+
+    SECTION("floating point") {
+        flat_map::flat_set<double> fs;
+        for (int i = 0; i < 1000; ++i) {
+            fs.insert(i * i * 0.5);
+        }
+        flat_map::learned_index const index{fs};
+        require_same_lookup(index, fs);
+    }
+
+    SECTION("empty") {
+        flat_map::learned_index const index{flat_map::flat_set<int>{}};
+        REQUIRE(index.empty());
+        REQUIRE(index.segment_count() == 0);
+        REQUIRE(index.lower_bound(0) == index.end());
+        REQUIRE_FALSE(index.contains(0));
+    }
+}
+
+TEST_CASE("learned_index mutation", "[learned_index]") {
+    flat_map::learned_index index{flat_map::flat_set<int>{1, 2, 3}, 1};
+
+    SECTION("modify") {
+        index.modify([](auto& fs) {
+            for (int i = 4; i < 1000; ++i) {
+                fs.insert(i * i);
+            }
+            fs.erase(2);
+        });
+        REQUIRE(index.size() == 998);
+        REQUIRE_FALSE(index.contains(2));
+        REQUIRE(index.contains(999 * 999));
+        REQUIRE(index.segment_count() > 1);
+    }
+
+    SECTION("extract") {
+        auto fs = std::move(index).extract();
+        REQUIRE(index.empty());
+        REQUIRE(index.segment_count() == 0);
+        REQUIRE(fs == flat_map::flat_set<int>{1, 2, 3});
+    }
+}
@@ -0,0 +1,18 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#include "flat_map/flat_map.hpp"
+#include "flat_map/small_vector.hpp"
+
+// Small enough that the tests cross the inline capacity.
+template <typename T>
+using CONTAINER = flat_map::small_vector<T, 4>;
+
+#define FLAT_MAP        1
+#define INLINE_STORAGE  1
+#define MULTI_CONTAINER 0
+#include "test_case/basic.ipp"
+#include "test_case/eytzinger_layout.ipp"
+#include "test_case/map_only.ipp"
+#include "test_case/stateful_comparison.ipp"
+#include "test_case/std.ipp"
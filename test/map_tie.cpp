@@ -14,6 +14,7 @@ using CONTAINER = flat_map::
 #define MULTI_CONTAINER 0
 #include "test_case/basic.ipp"
 #include "test_case/catch2_tuple.hpp"
+#include "test_case/eytzinger_layout.ipp"
 #include "test_case/map_only.ipp"
 #include "test_case/stateful_comparison.ipp"
 #include "test_case/std.ipp"
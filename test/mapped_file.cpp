@@ -0,0 +1,198 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "flat_map/flat_map.hpp"
+#include "flat_map/flat_multimap.hpp"
+#include "flat_map/flat_multiset.hpp"
+#include "flat_map/flat_set.hpp"
+#include "flat_map/mapped_file.hpp"
+#include "flat_map/tied_sequence.hpp"
+
+namespace {
+
+struct temporary_file {
+    std::string path;
+
+    explicit temporary_file(char const* name)
+        : path{(std::filesystem::temp_directory_path() / name).string()} {}
+    ~temporary_file() { std::remove(path.c_str()); }
+};
+
+struct point {
+    float x, y;
+};
+
+template <typename Flat, typename Mapped>
+void check_round_trip(Flat const& flat, Mapped const& mapped) {
+    REQUIRE(mapped.size() == flat.size());
+    auto const key_of = [](auto const& e) {
+        return flat_map::detail::key_of<typename Flat::key_type>(e);
+    };
+    auto const same_key = [&](auto const& l, auto const& r) { return key_of(l) == key_of(r); };
+    REQUIRE(std::equal(flat.begin(), flat.end(), mapped.begin(), mapped.end(), same_key));
+    for (auto const& e : flat) {
+        auto const key = key_of(e);
+        REQUIRE(mapped.count(key) == flat.count(key));
+        REQUIRE(mapped.contains(key));
+    }
+}
+
+}  // namespace
+
+TEST_CASE("mapped file round trip", "[mapped_file]") {
+    temporary_file file{"flat_map_mapped_file_test.bin"};
+    std::mt19937   rng{};
+
+    SECTION("flat_map") {
+        flat_map::flat_map<std::int64_t, point> fm;
+        for (int i = 0; i < 10000; ++i) {
+            auto const k = std::uniform_int_distribution<std::int64_t>{-100000, 100000}(rng);
+            fm.try_emplace(k, point{float(k), float(i)});
+        }
+        flat_map::save(fm, file.path);
+
+        flat_map::mapped_flat_map<std::int64_t, point> const mapped{file.path};
+        check_round_trip(fm, mapped);
+        for (auto const& [k, v] : fm) {
+            REQUIRE(mapped.at(k).x == v.x);
+            REQUIRE(mapped.at(k).y == v.y);
+        }
+        REQUIRE(mapped.find(100001) == mapped.end());
+    }
+
+    SECTION("tied flat_map") {
+        flat_map::flat_map<
+            int,
+            double,
+            std::greater<int>,
+            flat_map::tied_sequence<std::vector<int>, std::vector<double>>>
+            fm;
+        for (int i = 0; i < 5000; ++i) {
+            fm.insert_or_assign(std::uniform_int_distribution<int>{}(rng), i * 0.5);
+        }
+        flat_map::save(fm, file.path);
+
+        flat_map::mapped_flat_map<int, double, std::greater<int>> mapped{file.path};
+        check_round_trip(fm, mapped);
+        for (auto const& [k, v] : fm) {
+            REQUIRE(mapped.at(k) == v);
+        }
+
+        auto moved = std::move(mapped);
+        check_round_trip(fm, moved);
+    }
+
+    SECTION("flat_multimap") {
+        flat_map::flat_multimap<std::uint16_t, std::uint8_t> fm;
+        for (int i = 0; i < 5000; ++i) {
+            fm.emplace(std::uniform_int_distribution<std::uint16_t>{0, 300}(rng), i % 256);
+        }
+        flat_map::save(fm, file.path);
+
+        flat_map::mapped_flat_multimap<std::uint16_t, std::uint8_t> const mapped{file.path};
+        check_round_trip(fm, mapped);
+        auto const same_value = [](auto const& l, auto const& r) {
+            return std::get<1>(l) == std::get<1>(r);
+        };
+        REQUIRE(std::equal(fm.begin(), fm.end(), mapped.begin(), mapped.end(), same_value));
+    }
+
+    SECTION("flat_set") {
+        flat_map::flat_set<std::uint64_t> fs;
+        for (int i = 0; i < 10000; ++i) {
+            fs.insert(std::uniform_int_distribution<std::uint64_t>{}(rng));
+        }
+        flat_map::save(fs, file.path);
+
+        flat_map::mapped_flat_set<std::uint64_t> const mapped{file.path};
+        check_round_trip(fs, mapped);
+        REQUIRE(mapped.find(*fs.begin()) == mapped.begin());
+    }
+
+    SECTION("flat_multiset") {
+        flat_map::flat_multiset<char> fs{'a', 'b', 'b', 'c', 'c', 'c'};
+        flat_map::save(fs, file.path);
+
+        flat_map::mapped_flat_multiset<char> const mapped{file.path};
+        check_round_trip(fs, mapped);
+    }
+
+    SECTION("empty") {
+        flat_map::save(flat_map::flat_map<int, int>{}, file.path);
+
+        flat_map::mapped_flat_map<int, int> const mapped{file.path};
+        REQUIRE(mapped.empty());
+        REQUIRE(mapped.find(0) == mapped.end());
+    }
+
+    SECTION("view") {
+        std::vector<int> keys{1, 2, 3};
+        flat_map::save(flat_map::flat_set_view{keys.data(), keys.size()}, file.path);
+
+        flat_map::mapped_flat_set<int> const mapped{file.path};
+        REQUIRE(std::equal(keys.begin(), keys.end(), mapped.begin(), mapped.end()));
+    }
+}
+
+TEST_CASE("mapped file errors", "[mapped_file]") {
+    temporary_file file{"flat_map_mapped_file_error.bin"};
+    flat_map::save(flat_map::flat_map<int, int>{{1, 2}, {3, 4}}, file.path);
+
+    SECTION("type mismatch") {
+        REQUIRE_THROWS_AS((flat_map::mapped_flat_map<int, float>{file.path}), std::runtime_error);
+        REQUIRE_THROWS_AS((flat_map::mapped_flat_set<int>{file.path}), std::runtime_error);
+        REQUIRE_THROWS_AS(
+            (flat_map::mapped_flat_multimap<int, int>{file.path}), std::runtime_error
+        );
+    }
+
+    SECTION("comparator mismatch") {
+        REQUIRE_THROWS_AS(
+            (flat_map::mapped_flat_map<int, int, std::greater<int>>{file.path}), std::runtime_error
+        );
+    }
+
+    SECTION("truncated") {
+        std::filesystem::resize_file(file.path, 70);
+        REQUIRE_THROWS_AS((flat_map::mapped_flat_map<int, int>{file.path}), std::runtime_error);
+        std::filesystem::resize_file(file.path, sizeof(flat_map::detail::mapped_header) + 8);
+        REQUIRE_THROWS_AS((flat_map::mapped_flat_map<int, int>{file.path}), std::runtime_error);
+    }
+
+    SECTION("forged count") {
+        // The end of the key column wraps around to the one of the actual file.
+        std::uint64_t const count = (std::uint64_t(1) << 62) + 2;
+        std::fstream        f{file.path, std::ios::in | std::ios::out | std::ios::binary};
+        f.seekp(offsetof(flat_map::detail::mapped_header, count));
+        f.write(reinterpret_cast<char const*>(&count), sizeof(count));
+        f.close();
+        REQUIRE_THROWS_AS((flat_map::mapped_flat_map<int, int>{file.path}), std::runtime_error);
+    }
+
+    SECTION("not a flat_map file") {
+        std::ofstream{file.path} << "hello, world";
+        REQUIRE_THROWS_AS((flat_map::mapped_flat_map<int, int>{file.path}), std::runtime_error);
+    }
+
+    SECTION("no such file") {
+        REQUIRE_THROWS_AS(
+            (flat_map::mapped_flat_map<int, int>{file.path + ".missing"}), std::system_error
+        );
+    }
+}
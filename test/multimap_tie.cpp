@@ -14,5 +14,6 @@ using CONTAINER = flat_map::
 #define MULTI_CONTAINER 1
 #include "test_case/basic.ipp"
 #include "test_case/catch2_tuple.hpp"
+#include "test_case/eytzinger_layout.ipp"
 #include "test_case/stateful_comparison.ipp"
 #include "test_case/std.ipp"
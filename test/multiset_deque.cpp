@@ -11,5 +11,6 @@ using CONTAINER = std::deque<T>;
 #define FLAT_MAP        0
 #define MULTI_CONTAINER 1
 #include "test_case/basic.ipp"
+#include "test_case/eytzinger_layout.ipp"
 #include "test_case/stateful_comparison.ipp"
 #include "test_case/std.ipp"
@@ -0,0 +1,107 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <deque>
+#include <functional>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "flat_map/__permutation_sort.hpp"
+#include "flat_map/columnar_sequence.hpp"
+#include "flat_map/flat_multimap.hpp"
+#include "flat_map/tied_sequence.hpp"
+
+template <typename Key>
+static Key make_key(int r) {
+    if constexpr (std::is_same_v<Key, std::string>) {
+        return std::to_string(r);
+    } else {
+        return static_cast<Key>(r);
+    }
+}
+
+template <typename Seq>
+static void fill(Seq& seq, std::size_t n) {
+    using key_type = std::tuple_element_t<0, typename Seq::value_type>;
+
+    std::mt19937 rng{};
+    for (std::size_t i = 0; i < n; ++i) {
+        auto const r = std::uniform_int_distribution<int>{-300, 300}(rng);
+        seq.emplace_back(make_key<key_type>(r), static_cast<int>(i), std::to_string(i));
+    }
+}
+
+template <typename Seq, typename Compare>
+static void check_permutation_sort() {
+    using value_type = typename Seq::value_type;
+    using key_type   = std::tuple_element_t<0, value_type>;
+
+    for (std::size_t n : {0, 1, 2, 100, 5000}) {
+        Seq seq;
+        fill(seq, n);
+
+        std::vector<value_type> expected(seq.begin(), seq.end());
+        std::stable_sort(expected.begin(), expected.end(), [](auto& lhs, auto& rhs) {
+            return Compare{}(std::get<0>(lhs), std::get<0>(rhs));
+        });
+
+        flat_map::detail::permutation_sort<key_type>(seq.begin(), seq.end(), Compare{});
+        REQUIRE(std::equal(seq.begin(), seq.end(), expected.begin(), expected.end()));
+    }
+}
+
+TEST_CASE("permutation sort", "[permutation_sort]") {
+    SECTION("radix sortable keys") {
+        check_permutation_sort<
+            flat_map::tied_sequence<std::vector<int>, std::vector<int>, std::vector<std::string>>,
+            std::less<int>>();
+    }
+    SECTION("greater") {
+        check_permutation_sort<
+            flat_map::tied_sequence<std::vector<long>, std::deque<int>, std::vector<std::string>>,
+            std::greater<>>();
+    }
+    SECTION("non trivially copyable keys") {
+        check_permutation_sort<
+            flat_map::tied_sequence<
+                std::vector<std::string>,
+                std::vector<int>,
+                std::vector<std::string>>,
+            std::less<>>();
+    }
+    SECTION("columnar_sequence") {
+        check_permutation_sort<
+            flat_map::columnar_sequence<double, int, std::string>,
+            std::less<double>>();
+    }
+}
+
+TEST_CASE("sort tied containers by permutation", "[permutation_sort]") {
+    using tied_t = flat_map::tied_sequence<std::vector<int>, std::vector<std::string>>;
+    flat_map::flat_multimap<int, std::string, std::less<int>, tied_t> fm{
+        {3, "a"},
+        {1, "b"},
+        {3, "c"},
+        {2, "d"},
+        {1, "e"},
+    };
+    REQUIRE(fm.size() == 5);
+
+    fm.insert({{2, "f"}, {0, "g"}, {3, "h"}});
+
+    std::vector<std::tuple<int, std::string>> const expected = {
+        {0, "g"},
+        {1, "b"},
+        {1, "e"},
+        {2, "d"},
+        {2, "f"},
+        {3, "a"},
+        {3, "c"},
+        {3, "h"},
+    };
+    REQUIRE(std::equal(fm.begin(), fm.end(), expected.begin(), expected.end()));
+}
@@ -0,0 +1,189 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "flat_map/__radix_sort.hpp"
+#include "flat_map/flat_map.hpp"
+#include "flat_map/flat_multimap.hpp"
+#include "flat_map/flat_set.hpp"
+#include "flat_map/tied_sequence.hpp"
+
+template <typename Key>
+static std::vector<std::pair<Key, int>> random_pairs(std::size_t n) {
+    std::mt19937                     rng{};
+    std::vector<std::pair<Key, int>> v;
+    for (std::size_t i = 0; i < n; ++i) {
+        auto const r = std::uniform_int_distribution<int>{-300, 300}(rng);
+        v.emplace_back(static_cast<Key>(r), static_cast<int>(i));
+    }
+    v.emplace_back(std::numeric_limits<Key>::max(), -1);
+    v.emplace_back(std::numeric_limits<Key>::lowest(), -2);
+    return v;
+}
+
+template <typename Key, typename Compare>
+static void check_radix_sort() {
+    for (std::size_t n : {0, 1, 2, 100, 5000}) {
+        auto v        = random_pairs<Key>(n);
+        auto expected = v;
+        std::stable_sort(expected.begin(), expected.end(), [](auto& lhs, auto& rhs) {
+            return Compare{}(lhs.first, rhs.first);
+        });
+        flat_map::detail::radix_sort<Key, Compare>(v.begin(), v.end(), [](auto& p) {
+            return p.first;
+        });
+        REQUIRE(v == expected);
+    }
+}
+
+TEST_CASE("radix sort", "[radix_sort]") {
+    SECTION("int8_t") { check_radix_sort<std::int8_t, std::less<std::int8_t>>(); }
+    SECTION("uint16_t") { check_radix_sort<std::uint16_t, std::less<>>(); }
+    SECTION("int32_t") { check_radix_sort<std::int32_t, std::less<std::int32_t>>(); }
+    SECTION("int32_t greater") { check_radix_sort<std::int32_t, std::greater<std::int32_t>>(); }
+    SECTION("uint64_t") { check_radix_sort<std::uint64_t, std::less<std::uint64_t>>(); }
+    SECTION("int64_t greater") { check_radix_sort<std::int64_t, std::greater<>>(); }
+    SECTION("float") { check_radix_sort<float, std::less<float>>(); }
+    SECTION("double greater") { check_radix_sort<double, std::greater<double>>(); }
+}
+
+TEST_CASE("radix sortable", "[radix_sort]") {
+    static_assert(flat_map::detail::is_radix_sortable_v<int, std::less<int>>);
+    static_assert(flat_map::detail::is_radix_sortable_v<unsigned char, std::greater<>>);
+    static_assert(flat_map::detail::is_radix_sortable_v<double, std::less<>>);
+    static_assert(!flat_map::detail::is_radix_sortable_v<bool, std::less<bool>>);
+    static_assert(!flat_map::detail::is_radix_sortable_v<long double, std::less<long double>>);
+    static_assert(!flat_map::detail::is_radix_sortable_v<int, std::less<long>>);
+    static_assert(!flat_map::detail::is_radix_sortable_v<int, std::less_equal<int>>);
+}
+
+template <typename Flat>
+static bool same_elements(Flat const& fm, std::vector<std::pair<int, int>> const& v) {
+    return std::equal(fm.begin(), fm.end(), v.begin(), v.end(), [](auto const& lhs, auto& rhs) {
+        return std::get<0>(lhs) == rhs.first && std::get<1>(lhs) == rhs.second;
+    });
+}
+
+template <typename Flat, typename Compare>
+static void check_construction(std::vector<std::pair<int, int>> const& v) {
+    std::vector<std::pair<int, int>> expected;
+    for (auto const& p : v) {
+        auto const dup = std::find_if(expected.begin(), expected.end(), [&](auto& e) {
+            return e.first == p.first;
+        });
+        if (dup == expected.end()) {
+            expected.push_back(p);
+        }
+    }
+    std::stable_sort(expected.begin(), expected.end(), [](auto& lhs, auto& rhs) {
+        return Compare{}(lhs.first, rhs.first);
+    });
+
+    Flat const fm{v.begin(), v.end()};
+    REQUIRE(same_elements(fm, expected));
+
+    Flat sorted{
+        flat_map::range_order::no_ordered,
+        std::decay_t<decltype(fm.get_container())>(v.begin(), v.end())
+    };
+    REQUIRE(sorted == fm);
+
+    auto const mid = std::next(v.begin(), v.size() / 2);
+    Flat       inserted{v.begin(), mid};
+    inserted.insert(flat_map::range_order::no_ordered, mid, v.end());
+    REQUIRE(inserted == fm);
+}
+
+TEST_CASE("radix sort construction", "[radix_sort]") {
+    auto const v = random_pairs<int>(3000);
+
+    SECTION("flat_map") { check_construction<flat_map::flat_map<int, int>, std::less<int>>(v); }
+
+    SECTION("flat_map greater") {
+        check_construction<flat_map::flat_map<int, int, std::greater<int>>, std::greater<int>>(v);
+    }
+
+    SECTION("tied flat_map") {
+        check_construction<
+            flat_map::flat_map<
+                int,
+                int,
+                std::less<int>,
+                flat_map::tied_sequence<std::vector<int>, std::vector<int>>>,
+            std::less<int>>(v);
+    }
+
+    SECTION("flat_multimap") {
+        flat_map::flat_multimap<int, int> const fm{v.begin(), v.end()};
+
+        auto expected = v;
+        std::stable_sort(expected.begin(), expected.end(), [](auto& lhs, auto& rhs) {
+            return lhs.first < rhs.first;
+        });
+        REQUIRE(same_elements(fm, expected));
+    }
+
+    SECTION("flat_set") {
+        std::vector<std::int32_t> keys;
+        for (auto const& p : v) {
+            keys.push_back(p.first);
+        }
+        flat_map::flat_set<std::int32_t> const fs{keys.begin(), keys.end()};
+
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+        REQUIRE(std::equal(fs.begin(), fs.end(), keys.begin(), keys.end()));
+    }
+}
+
+TEST_CASE("radix sort signed zeros", "[radix_sort]") {
+    // -0.0 and +0.0 are equivalent, so that they keep their relative order.
+    std::vector<std::pair<double, int>> v{
+        {0.0,  1},
+        {-0.0, 2}
+    };
+    for (int i = 0; i < 2000; ++i) {
+        v.emplace_back(double(i % 2 ? i : -i) / 7, i + 3);
+    }
+
+    SECTION("flat_map") {
+        flat_map::flat_map<double, int> const fm{v.begin(), v.end()};
+        REQUIRE(fm.find(0.0)->second == 1);
+        REQUIRE(fm.find(-0.0)->second == 1);
+    }
+
+    SECTION("flat_map greater") {
+        flat_map::flat_map<double, int, std::greater<double>> const fm{v.begin(), v.end()};
+        REQUIRE(fm.find(0.0)->second == 1);
+    }
+
+    SECTION("flat_multimap") {
+        flat_map::flat_multimap<double, int> const fm{v.begin(), v.end()};
+        auto const [first, last] = fm.equal_range(0.0);
+        REQUIRE(std::distance(first, last) == 3);
+        REQUIRE(first->second == 1);
+        REQUIRE(std::next(first)->second == 2);
+        REQUIRE(std::next(first, 2)->second == 3);
+    }
+
+    SECTION("tied flat_map") {
+        flat_map::flat_map<
+            double,
+            int,
+            std::less<double>,
+            flat_map::tied_sequence<std::vector<double>, std::vector<int>>> const fm{
+            v.begin(), v.end()
+        };
+        REQUIRE(std::get<1>(*fm.find(0.0)) == 1);
+    }
+}
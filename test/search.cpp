@@ -0,0 +1,325 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "flat_map/__search.hpp"
+#include "flat_map/flat_map.hpp"
+#include "flat_map/flat_multimap.hpp"
+#include "flat_map/flat_multiset.hpp"
+#include "flat_map/flat_set.hpp"
+#include "flat_map/search_policy.hpp"
+#include "flat_map/tied_sequence.hpp"
+
+template <typename T>
+static std::vector<T> sorted_values() {
+    std::vector<T> v;
+    for (int i = -100; i < 100; ++i) {
+        v.push_back(static_cast<T>(i * 3));
+        v.push_back(static_cast<T>(i * 3));
+    }
+    v.push_back(std::numeric_limits<T>::max());
+    v.push_back(std::numeric_limits<T>::lowest());
+    std::sort(v.begin(), v.end());
+    return v;
+}
+
+template <typename T>
+static void check_bound() {
+    auto const v = sorted_values<T>();
+    for (std::size_t n = 0; n <= v.size(); n += 7) {
+        for (int i = -310; i < 310; ++i) {
+            auto const key = static_cast<T>(i);
+            auto const lb  = std::lower_bound(v.begin(), v.begin() + n, key) - v.begin();
+            auto const ub  = std::upper_bound(v.begin(), v.begin() + n, key) - v.begin();
+            REQUIRE(flat_map::detail::simd_bound<true>(v.data(), n, key) == std::size_t(lb));
+            REQUIRE(flat_map::detail::simd_bound<false>(v.data(), n, key) == std::size_t(ub));
+        }
+    }
+}
+
+TEST_CASE("simd bound", "[search]") {
+    SECTION("int32_t") { check_bound<std::int32_t>(); }
+    SECTION("uint32_t") { check_bound<std::uint32_t>(); }
+    SECTION("int64_t") { check_bound<std::int64_t>(); }
+    SECTION("uint64_t") { check_bound<std::uint64_t>(); }
+    SECTION("float") { check_bound<float>(); }
+    SECTION("double") { check_bound<double>(); }
+}
+
+TEST_CASE("simd searchable", "[search]") {
+    static_assert(flat_map::detail::is_simd_searchable_v<int, std::less<int>, int>);
+    static_assert(flat_map::detail::is_simd_searchable_v<double, std::less<>, double>);
+    static_assert(!flat_map::detail::is_simd_searchable_v<int, std::greater<int>, int>);
+    static_assert(!flat_map::detail::is_simd_searchable_v<int, std::less<>, long>);
+    static_assert(!flat_map::detail::is_simd_searchable_v<short, std::less<short>, short>);
+    static_assert(!flat_map::detail::is_simd_searchable_v<bool, std::less<bool>, bool>);
+}
+
+template <typename Flat, typename T>
+static void check_lookup(Flat const& fm, std::vector<T> const& v) {
+    for (int i = -310; i < 310; ++i) {
+        auto const key = static_cast<T>(i);
+        auto const lb  = std::lower_bound(v.begin(), v.end(), key) - v.begin();
+        auto const ub  = std::upper_bound(v.begin(), v.end(), key) - v.begin();
+        REQUIRE(std::distance(fm.begin(), fm.lower_bound(key)) == lb);
+        REQUIRE(std::distance(fm.begin(), fm.upper_bound(key)) == ub);
+        REQUIRE(fm.contains(key) == std::binary_search(v.begin(), v.end(), key));
+    }
+}
+
+TEST_CASE("vectorized lookup", "[search]") {
+    SECTION("flat_set") {
+        auto v = sorted_values<std::uint64_t>();
+        v.erase(std::unique(v.begin(), v.end()), v.end());
+        flat_map::flat_set<std::uint64_t> fs{v.begin(), v.end()};
+        check_lookup(fs, v);
+
+        auto itr = fs.insert(fs.end(), 1);
+        REQUIRE(*itr == 1);
+        itr = fs.insert(fs.begin(), 2);
+        REQUIRE(*itr == 2);
+        REQUIRE(std::is_sorted(fs.begin(), fs.end()));
+    }
+
+    SECTION("flat_multiset") {
+        auto const                     v = sorted_values<float>();
+        flat_map::flat_multiset<float> fs{v.begin(), v.end()};
+        check_lookup(fs, v);
+
+        auto [first, last] = fs.equal_range(3.f);
+        REQUIRE(std::distance(first, last) == 2);
+    }
+
+    SECTION("tied flat_map") {
+        auto v = sorted_values<std::int32_t>();
+        v.erase(std::unique(v.begin(), v.end()), v.end());
+        flat_map::flat_map<
+            std::int32_t,
+            int,
+            std::less<std::int32_t>,
+            flat_map::tied_sequence<std::vector<std::int32_t>, std::vector<int>>>
+            fm;
+        for (auto k : v) {
+            fm.try_emplace(fm.end(), k, 0);
+        }
+        check_lookup(fm, v);
+    }
+}
+
+TEST_CASE("key column lookup", "[search]") {
+    using namespace std::literals;
+
+    flat_map::flat_multimap<
+        std::string,
+        int,
+        std::less<>,
+        flat_map::tied_sequence<std::deque<std::string>, std::vector<int>>>
+        fm = {
+            {"alpha", 0},
+            {"bravo", 1},
+            {"bravo", 2},
+            {"delta", 3},
+            {"echo", 4},
+        };
+
+    REQUIRE(fm.lower_bound("bravo"sv) == std::next(fm.begin()));
+    REQUIRE(fm.upper_bound("bravo"sv) == std::next(fm.begin(), 3));
+    REQUIRE(fm.lower_bound("charlie"sv) == std::next(fm.begin(), 3));
+    REQUIRE(fm.count("bravo"sv) == 2);
+    REQUIRE(fm.find("echo"sv) == std::next(fm.begin(), 4));
+    REQUIRE(fm.find("foxtrot"sv) == fm.end());
+
+    auto itr = fm.insert(std::next(fm.begin(), 4), {"charlie", 5});
+    REQUIRE(itr == std::next(fm.begin(), 3));
+    REQUIRE(std::get<1>(*itr) == 5);
+}
+
+TEST_CASE("linear bound", "[search]") {
+    auto v = sorted_values<int>();
+    std::reverse(v.begin(), v.end());
+    for (std::size_t n = 0; n <= 40; ++n) {
+        for (int i = -310; i < 310; ++i) {
+            auto const lb = std::lower_bound(v.begin(), v.begin() + n, i, std::greater<>{});
+            auto const ub = std::upper_bound(v.begin(), v.begin() + n, i, std::greater<>{});
+            REQUIRE(
+                flat_map::detail::linear_bound<true>(v.begin(), n, i, std::greater<>{})
+                == std::size_t(lb - v.begin())
+            );
+            REQUIRE(
+                flat_map::detail::linear_bound<false>(v.begin(), n, i, std::greater<>{})
+                == std::size_t(ub - v.begin())
+            );
+        }
+    }
+}
+
+namespace {
+
+struct string_less : std::less<std::string> {};
+
+}  // namespace
+
+template <>
+struct flat_map::linear_search_threshold<std::string, string_less>
+    : public std::integral_constant<std::size_t, 8> {};
+
+TEST_CASE("small size lookup", "[search]") {
+    static_assert(flat_map::detail::linear_search_threshold_v<int, std::greater<int>> == 16);
+    static_assert(flat_map::detail::linear_search_threshold_v<std::string, std::less<>> == 0);
+    static_assert(flat_map::detail::linear_search_threshold_v<std::string, string_less> == 8);
+
+    SECTION("flat_multimap") {
+        for (int n = 0; n <= 40; ++n) {
+            std::vector<int>                                     v;
+            flat_map::flat_multimap<int, int, std::greater<int>> fm;
+            for (int i = 0; i < n; ++i) {
+                v.push_back(i / 2 * 3);
+                fm.emplace_hint(std::next(fm.begin(), fm.size() / 2), i / 2 * 3, i);
+            }
+            std::sort(v.begin(), v.end(), std::greater<>{});
+            REQUIRE(fm.size() == v.size());
+
+            for (int key = -2; key < n * 2; ++key) {
+                auto const lb = std::lower_bound(v.begin(), v.end(), key, std::greater<>{});
+                auto const ub = std::upper_bound(v.begin(), v.end(), key, std::greater<>{});
+                REQUIRE(std::distance(fm.begin(), fm.lower_bound(key)) == lb - v.begin());
+                REQUIRE(std::distance(fm.begin(), fm.upper_bound(key)) == ub - v.begin());
+                REQUIRE((fm.find(key) != fm.end()) == (lb != ub));
+            }
+        }
+    }
+
+    SECTION("flat_map with tuned threshold") {
+        flat_map::flat_map<std::string, int, string_less> fm;
+        for (int i = 0; i < 12; ++i) {
+            fm.emplace_hint(fm.begin(), std::to_string(i), i);
+        }
+        REQUIRE(fm.size() == 12);
+        REQUIRE(std::is_sorted(fm.begin(), fm.end()));
+        for (int i = 0; i < 12; ++i) {
+            REQUIRE(fm.find(std::to_string(i))->second == i);
+        }
+        REQUIRE(fm.find("12") == fm.end());
+        REQUIRE(fm.lower_bound("10") == std::next(fm.begin(), 2));
+    }
+}
+
+template <typename T>
+static void check_interpolation_narrow(std::vector<T> const& v) {
+    auto const identity = [](T k) { return k; };
+    for (std::size_t n = 0; n <= v.size(); n += 7) {
+        for (int i = -310; i < 310; ++i) {
+            auto const key = static_cast<T>(i);
+            auto const lb  = std::lower_bound(v.begin(), v.begin() + n, key) - v.begin();
+            auto const ub  = std::upper_bound(v.begin(), v.begin() + n, key) - v.begin();
+            auto const [lb_lo, lb_hi] =
+                flat_map::detail::interpolation_narrow<true>(v.data(), n, key, identity);
+            auto const [ub_lo, ub_hi] =
+                flat_map::detail::interpolation_narrow<false>(v.data(), n, key, identity);
+            REQUIRE((lb_lo <= std::size_t(lb) && std::size_t(lb) <= lb_hi));
+            REQUIRE((ub_lo <= std::size_t(ub) && std::size_t(ub) <= ub_hi));
+        }
+    }
+}
+
+TEST_CASE("interpolation narrow", "[search]") {
+    SECTION("int32_t") { check_interpolation_narrow(sorted_values<std::int32_t>()); }
+    SECTION("uint64_t") { check_interpolation_narrow(sorted_values<std::uint64_t>()); }
+    SECTION("int64_t") { check_interpolation_narrow(sorted_values<std::int64_t>()); }
+    SECTION("double") { check_interpolation_narrow(sorted_values<double>()); }
+
+    SECTION("skewed") {
+        // Each key doubles the preceding one, so that interpolation always undershoots.
+        std::vector<std::int64_t> v;
+        for (int i = 0; i < 62; ++i) {
+            v.push_back(std::int64_t(1) << i);
+            v.push_back(-(std::int64_t(1) << i));
+        }
+        std::sort(v.begin(), v.end());
+        check_interpolation_narrow(v);
+    }
+}
+
+namespace {
+
+struct id_less : std::less<std::int64_t> {};
+struct hinted_less : std::less<int> {};
+
+}  // namespace
+
+template <>
+struct flat_map::search_policy<std::int64_t, id_less> {
+    using type = interpolation_search_policy;
+};
+
+template <>
+struct flat_map::search_policy<int, hinted_less> {
+    using type = exponential_search_policy;
+};
+
+TEST_CASE("search policy", "[search]") {
+    static_assert(std::is_same_v<
+                  flat_map::detail::search_policy_t<int, std::less<int>>,
+                  flat_map::binary_search_policy>);
+
+    auto v = sorted_values<std::int64_t>();
+    v.erase(std::unique(v.begin(), v.end()), v.end());
+
+    SECTION("interpolation flat_set") {
+        flat_map::flat_set<std::int64_t, id_less> fs{v.begin(), v.end()};
+        check_lookup(fs, v);
+    }
+
+    SECTION("interpolation flat_map") {
+        flat_map::flat_map<std::int64_t, int, id_less> fm;
+        for (auto k : v) {
+            fm.try_emplace(fm.end(), k, 0);
+        }
+        check_lookup(fm, v);
+    }
+
+    SECTION("interpolation tied flat_multimap") {
+        flat_map::flat_multimap<
+            std::int64_t,
+            int,
+            id_less,
+            flat_map::tied_sequence<std::vector<std::int64_t>, std::vector<int>>>
+            fm;
+        for (auto k : sorted_values<std::int64_t>()) {
+            fm.emplace(k, 0);
+        }
+        check_lookup(fm, sorted_values<std::int64_t>());
+    }
+
+    SECTION("exponential insertion with hint") {
+        std::vector<int>                          expected;
+        flat_map::flat_set<int, hinted_less>      fs;
+        flat_map::flat_multiset<int, hinted_less> fms;
+        for (int i = 0; i < 500; ++i) {
+            auto const key = (i * 37) % 101;
+            auto const pos = std::size_t(i * 13) % (fms.size() + 1);
+            expected.push_back(key);
+            fs.insert(std::next(fs.begin(), std::min(pos, fs.size())), key);
+            fms.insert(std::next(fms.begin(), pos), key);
+        }
+        std::sort(expected.begin(), expected.end());
+        REQUIRE(std::vector<int>(fms.begin(), fms.end()) == expected);
+        expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+        REQUIRE(std::vector<int>(fs.begin(), fs.end()) == expected);
+        for (int i = 0; i < 101; ++i) {
+            REQUIRE(*fs.insert(std::next(fs.begin(), i), i) == i);
+        }
+        REQUIRE(fs.size() == 101);
+    }
+}
@@ -0,0 +1,150 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "flat_map/flat_map.hpp"
+#include "flat_map/flat_multimap.hpp"
+#include "flat_map/flat_multiset.hpp"
+#include "flat_map/flat_set.hpp"
+#include "flat_map/set_algorithm.hpp"
+#include "flat_map/tied_sequence.hpp"
+
+namespace {
+
+// Makes n elements whose keys are in [0, range), by make(key, index).
+template <typename Flat, typename F>
+Flat random_flat(std::size_t n, int range, unsigned seed, F make) {
+    std::mt19937 rng{seed};
+    Flat         flat;
+    for (std::size_t i = 0; i < n; ++i) {
+        flat.insert(make(std::uniform_int_distribution<int>{0, range - 1}(rng), int(i)));
+    }
+    return flat;
+}
+
+// Compares the results with the ones of std::set_* on the same inputs.
+template <typename Flat>
+void check_set_algorithms(Flat const& a, Flat const& b) {
+    using key_type   = typename Flat::key_type;
+    using value_type = typename Flat::value_type;
+
+    auto const comp = [&](auto const& l, auto const& r) {
+        return a.key_comp()(
+            flat_map::detail::key_of<key_type>(l), flat_map::detail::key_of<key_type>(r)
+        );
+    };
+    auto const std_result = [&](auto algorithm) {
+        std::vector<value_type> v;
+        algorithm(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(v), comp);
+        return v;
+    };
+    auto const check = [](Flat const& result, std::vector<value_type> const& expected) {
+        REQUIRE(result.size() == expected.size());
+        REQUIRE(std::equal(result.begin(), result.end(), expected.begin(), expected.end()));
+    };
+
+    check(flat_map::set_union(a, b), std_result([](auto... args) {
+              return std::set_union(args...);
+          }));
+    check(flat_map::set_intersection(a, b), std_result([](auto... args) {
+              return std::set_intersection(args...);
+          }));
+    check(flat_map::set_difference(a, b), std_result([](auto... args) {
+              return std::set_difference(args...);
+          }));
+    check(flat_map::set_symmetric_difference(a, b), std_result([](auto... args) {
+              return std::set_symmetric_difference(args...);
+          }));
+}
+
+// Inputs of balanced and skewed sizes, dense and sparse keys, and empty ones.
+template <typename Flat, typename F>
+void check_set_algorithms(F make) {
+    for (auto [n, m, range] : std::vector<std::tuple<std::size_t, std::size_t, int>>{
+             {0,    0,    10     },
+             {0,    100,  1000   },
+             {100,  0,    1000   },
+             {1000, 1000, 1500   },
+             {1000, 1000, 100    },
+             {3000, 50,   5000   },
+             {20,   5000, 5000   },
+             {5000, 7,    1000000},
+    }) {
+        auto const a = random_flat<Flat>(n, range, 1, make);
+        auto const b = random_flat<Flat>(m, range, 2, make);
+        check_set_algorithms(a, b);
+        check_set_algorithms(b, a);
+        check_set_algorithms(a, a);
+    }
+}
+
+}  // namespace
+
+TEST_CASE("set algorithms", "[set_algorithm]") {
+    auto const key       = [](int k, int) { return k; };
+    auto const key_value = [](int k, int i) { return std::pair{k, i}; };
+
+    SECTION("flat_set<int>") { check_set_algorithms<flat_map::flat_set<int>>(key); }
+
+    SECTION("flat_set<std::uint64_t>") {
+        check_set_algorithms<flat_map::flat_set<std::uint64_t>>([](int k, int) {
+            return std::uint64_t(k) << 40 | std::uint64_t(k);
+        });
+    }
+
+    SECTION("flat_set<int, std::greater<int>>") {
+        check_set_algorithms<flat_map::flat_set<int, std::greater<int>>>(key);
+    }
+
+    SECTION("flat_set<std::string>") {
+        check_set_algorithms<flat_map::flat_set<std::string>>([](int k, int) {
+            return std::to_string(k);
+        });
+    }
+
+    SECTION("flat_set<int> on deque") {
+        check_set_algorithms<flat_map::flat_set<int, std::less<int>, std::deque<int>>>(key);
+    }
+
+    SECTION("flat_multiset<int>") { check_set_algorithms<flat_map::flat_multiset<int>>(key); }
+
+    SECTION("flat_map<int, int>") { check_set_algorithms<flat_map::flat_map<int, int>>(key_value); }
+
+    SECTION("tied flat_map<int, int>") {
+        using tied = flat_map::tied_sequence<std::vector<int>, std::vector<int>>;
+        using map  = flat_map::flat_map<int, int, std::less<int>, tied>;
+        check_set_algorithms<map>(key_value);
+    }
+
+    SECTION("flat_multimap<int, int>") {
+        check_set_algorithms<flat_map::flat_multimap<int, int>>(key_value);
+    }
+}
+
+TEST_CASE("set algorithms keep values of the first", "[set_algorithm]") {
+    flat_map::flat_map<int, char> const a{{1, 'a'}, {2, 'a'}, {4, 'a'}};
+    flat_map::flat_map<int, char> const b{{2, 'b'}, {3, 'b'}, {4, 'b'}};
+
+    REQUIRE(
+        flat_map::set_union(a, b)
+        == flat_map::flat_map<int, char>{{1, 'a'}, {2, 'a'}, {3, 'b'}, {4, 'a'}}
+    );
+    REQUIRE(flat_map::set_intersection(a, b) == flat_map::flat_map<int, char>{{2, 'a'}, {4, 'a'}});
+    REQUIRE(flat_map::set_difference(a, b) == flat_map::flat_map<int, char>{{1, 'a'}});
+    REQUIRE(
+        flat_map::set_symmetric_difference(a, b)
+        == flat_map::flat_map<int, char>{{1, 'a'}, {3, 'b'}}
+    );
+    REQUIRE(flat_map::set_union(a, b).get_container().capacity() == 4);
+}
@@ -0,0 +1,18 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#include "flat_map/flat_set.hpp"
+#include "flat_map/static_vector.hpp"
+
+// Large enough for the tests, except ones which are disabled by FIXED_CAPACITY.
+template <typename T>
+using CONTAINER = flat_map::static_vector<T, 512>;
+
+#define FLAT_MAP        0
+#define INLINE_STORAGE  1
+#define FIXED_CAPACITY  1
+#define MULTI_CONTAINER 0
+#include "test_case/basic.ipp"
+#include "test_case/eytzinger_layout.ipp"
+#include "test_case/stateful_comparison.ipp"
+#include "test_case/std.ipp"
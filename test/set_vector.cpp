@@ -12,5 +12,6 @@ using CONTAINER = std::vector<T>;
 #define MULTI_CONTAINER 0
 #include "test_case/basic.ipp"
 #include "test_case/deduction_guide.ipp"
+#include "test_case/eytzinger_layout.ipp"
 #include "test_case/stateful_comparison.ipp"
 #include "test_case/std.ipp"
@@ -0,0 +1,204 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "flat_map/flat_map.hpp"
+#include "flat_map/flat_set.hpp"
+#include "flat_map/small_vector.hpp"
+
+namespace {
+
+template <typename Seq>
+std::vector<typename Seq::value_type> to_vector(Seq const& seq) {
+    return {seq.begin(), seq.end()};
+}
+
+template <typename Seq>
+bool is_inline(Seq const& seq) {
+    auto const self = reinterpret_cast<std::uintptr_t>(std::addressof(seq));
+    auto const data = reinterpret_cast<std::uintptr_t>(seq.data());
+    return self <= data && data < self + sizeof(Seq);
+}
+
+// Throws on copy of the value 13.
+struct thrower {
+    int value;
+
+    thrower(int value) : value{value} {}
+    thrower(thrower const& other) : value{other.value} {
+        if (value == 13) {
+            throw std::runtime_error{"thirteen"};
+        }
+    }
+    thrower& operator=(thrower const&) = default;
+
+    bool operator==(thrower const& other) const { return value == other.value; }
+};
+
+}  // namespace
+
+TEST_CASE("small_vector construction", "[construction]") {
+    using vec_t = flat_map::small_vector<int, 4>;
+
+    SECTION("default") {
+        vec_t v;
+        REQUIRE(v.empty());
+        REQUIRE(v.capacity() == 4);
+        REQUIRE(is_inline(v));
+    }
+
+    SECTION("count") {
+        vec_t v(3, 7);
+        REQUIRE(to_vector(v) == std::vector{7, 7, 7});
+        REQUIRE(is_inline(v));
+
+        vec_t zeros(6);
+        REQUIRE(to_vector(zeros) == std::vector{0, 0, 0, 0, 0, 0});
+        REQUIRE(!is_inline(zeros));
+    }
+
+    SECTION("input iterator") {
+        std::istringstream is{"3 1 4 1 5"};
+        vec_t              v{std::istream_iterator<int>{is}, {}};
+        REQUIRE(to_vector(v) == std::vector{3, 1, 4, 1, 5});
+    }
+
+    SECTION("copy and move") {
+        for (vec_t const& v : {vec_t{1, 2}, vec_t{1, 2, 3, 4, 5, 6}}) {
+            vec_t copy = v;
+            REQUIRE(copy == v);
+
+            vec_t moved = std::move(copy);
+            REQUIRE(moved == v);
+            REQUIRE(copy.empty());
+            REQUIRE(is_inline(copy));
+
+            copy = moved;
+            REQUIRE(copy == v);
+
+            vec_t assigned{9};
+            assigned = std::move(moved);
+            REQUIRE(assigned == v);
+            REQUIRE(moved.empty());
+        }
+    }
+}
+
+TEST_CASE("small_vector capacity", "[capacity]") {
+    flat_map::small_vector<std::string, 2> v;
+    v.push_back("a");
+    v.push_back("b");
+    REQUIRE(v.capacity() == 2);
+    REQUIRE(is_inline(v));
+
+    v.push_back("c");
+    REQUIRE(v.capacity() >= 3);
+    REQUIRE(!is_inline(v));
+    REQUIRE(to_vector(v) == std::vector<std::string>{"a", "b", "c"});
+
+    v.reserve(100);
+    REQUIRE(v.capacity() == 100);
+
+    v.shrink_to_fit();
+    REQUIRE(v.capacity() == 3);
+
+    v.pop_back();
+    v.shrink_to_fit();
+    REQUIRE(v.capacity() == 2);
+    REQUIRE(is_inline(v));
+    REQUIRE(to_vector(v) == std::vector<std::string>{"a", "b"});
+}
+
+TEST_CASE("small_vector modifiers", "[modifiers]") {
+    using vec_t = flat_map::small_vector<std::string, 4>;
+
+    SECTION("insert") {
+        vec_t v{"a", "c"};
+        REQUIRE(*v.insert(v.begin() + 1, "b") == "b");
+        REQUIRE(*v.insert(v.end(), "d") == "d");
+        REQUIRE(*v.insert(v.begin(), "0") == "0");
+        REQUIRE(to_vector(v) == std::vector<std::string>{"0", "a", "b", "c", "d"});
+    }
+
+    SECTION("insert an element of itself") {
+        vec_t v{"a", "b", "c", "d"};
+        v.insert(v.begin(), v.back());
+        v.insert(v.begin() + 1, v.back());
+        REQUIRE(to_vector(v) == std::vector<std::string>{"d", "d", "a", "b", "c", "d"});
+        v.push_back(v.front());
+        REQUIRE(v.back() == "d");
+    }
+
+    SECTION("insert count and range") {
+        vec_t v{"a", "d"};
+        v.insert(v.begin() + 1, 2, "x");
+        REQUIRE(to_vector(v) == std::vector<std::string>{"a", "x", "x", "d"});
+
+        std::vector<std::string> const r{"b", "c"};
+        auto itr = v.insert(v.begin() + 1, r.begin(), r.end());
+        REQUIRE(itr == v.begin() + 1);
+        REQUIRE(to_vector(v) == std::vector<std::string>{"a", "b", "c", "x", "x", "d"});
+    }
+
+    SECTION("erase") {
+        vec_t v{"a", "b", "c", "d", "e"};
+        REQUIRE(*v.erase(v.begin() + 1) == "c");
+        REQUIRE(*v.erase(v.begin(), v.begin() + 2) == "d");
+        REQUIRE(to_vector(v) == std::vector<std::string>{"d", "e"});
+    }
+
+    SECTION("resize and assign") {
+        vec_t v;
+        v.resize(6, "z");
+        REQUIRE(v.size() == 6);
+        v.resize(1);
+        REQUIRE(to_vector(v) == std::vector<std::string>{"z"});
+        v.assign({"p", "q"});
+        REQUIRE(to_vector(v) == std::vector<std::string>{"p", "q"});
+        v.assign(5, "r");
+        REQUIRE(to_vector(v) == std::vector<std::string>(5, "r"));
+    }
+
+    SECTION("swap") {
+        vec_t small{"a"};
+        vec_t large{"b", "c", "d", "e", "f"};
+        small.swap(large);
+        REQUIRE(to_vector(small) == std::vector<std::string>{"b", "c", "d", "e", "f"});
+        REQUIRE(to_vector(large) == std::vector<std::string>{"a"});
+        swap(small, large);
+        REQUIRE(to_vector(small) == std::vector<std::string>{"a"});
+        REQUIRE(to_vector(large) == std::vector<std::string>{"b", "c", "d", "e", "f"});
+    }
+}
+
+TEST_CASE("small_vector exception safety", "[exception]") {
+    using vec_t = flat_map::small_vector<thrower, 2>;
+
+    vec_t v{1, 2};
+    REQUIRE_THROWS_AS(v.insert(v.begin(), thrower{13}), std::runtime_error);
+    REQUIRE(to_vector(v) == std::vector<thrower>{1, 2});
+    REQUIRE(v.capacity() == 2);
+}
+
+TEST_CASE("small flat containers", "[small_flat_map]") {
+    flat_map::small_flat_map<int, int, 4> fm;
+    for (int i = 8; i > 0; --i) {
+        fm.emplace(i, i * 10);
+        REQUIRE(is_inline(fm.get_container()) == (fm.size() <= 4));
+    }
+    REQUIRE(fm.size() == 8);
+    REQUIRE(fm.begin()->first == 1);
+    REQUIRE(fm.at(5) == 50);
+
+    flat_map::small_flat_set<int, 4> fs{3, 1, 2};
+    REQUIRE(is_inline(fs.get_container()));
+    REQUIRE(fs.contains(2));
+}
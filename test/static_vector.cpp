@@ -0,0 +1,305 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "flat_map/flat_map.hpp"
+#include "flat_map/flat_multimap.hpp"
+#include "flat_map/flat_multiset.hpp"
+#include "flat_map/flat_set.hpp"
+#include "flat_map/static_vector.hpp"
+
+namespace {
+
+std::size_t allocations = 0;
+
+template <typename Seq>
+std::vector<typename Seq::value_type> to_vector(Seq const& seq) {
+    return {seq.begin(), seq.end()};
+}
+
+}  // namespace
+
+// Counts allocations to check that static flat containers never allocate.
+void* operator new(std::size_t size) {
+    ++allocations;
+    if (auto ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+TEST_CASE("static_vector construction", "[construction]") {
+    using vec_t = flat_map::static_vector<int, 4>;
+
+    SECTION("default") {
+        vec_t v;
+        REQUIRE(v.empty());
+        REQUIRE_FALSE(v.full());
+        REQUIRE(v.capacity() == 4);
+        REQUIRE(v.max_size() == 4);
+    }
+
+    SECTION("count") {
+        vec_t v(3, 7);
+        REQUIRE(to_vector(v) == std::vector{7, 7, 7});
+
+        vec_t zeros(4);
+        REQUIRE(to_vector(zeros) == std::vector{0, 0, 0, 0});
+        REQUIRE(zeros.full());
+
+        REQUIRE_THROWS_AS(vec_t(5), std::length_error);
+    }
+
+    SECTION("input iterator") {
+        std::istringstream is{"3 1 4 1"};
+        vec_t              v{std::istream_iterator<int>{is}, {}};
+        REQUIRE(to_vector(v) == std::vector{3, 1, 4, 1});
+
+        std::istringstream overflow{"3 1 4 1 5"};
+        REQUIRE_THROWS_AS((vec_t{std::istream_iterator<int>{overflow}, {}}), std::length_error);
+    }
+
+    SECTION("copy and move") {
+        vec_t const v{1, 2, 3};
+
+        vec_t copy = v;
+        REQUIRE(copy == v);
+
+        vec_t moved = std::move(copy);
+        REQUIRE(moved == v);
+        REQUIRE(copy.empty());
+
+        copy = moved;
+        REQUIRE(copy == v);
+
+        vec_t assigned{9, 8, 7, 6};
+        assigned = std::move(moved);
+        REQUIRE(assigned == v);
+        REQUIRE(moved.empty());
+    }
+}
+
+TEST_CASE("static_vector modifiers", "[modifiers]") {
+    using vec_t = flat_map::static_vector<std::string, 6>;
+
+    SECTION("insert") {
+        vec_t v{"a", "c"};
+        REQUIRE(*v.insert(v.begin() + 1, "b") == "b");
+        REQUIRE(*v.insert(v.end(), "d") == "d");
+        REQUIRE(*v.insert(v.begin(), "0") == "0");
+        REQUIRE(to_vector(v) == std::vector<std::string>{"0", "a", "b", "c", "d"});
+    }
+
+    SECTION("insert an element of itself") {
+        vec_t v{"a", "b", "c", "d"};
+        v.insert(v.begin(), v.back());
+        v.insert(v.begin() + 1, v.back());
+        REQUIRE(to_vector(v) == std::vector<std::string>{"d", "d", "a", "b", "c", "d"});
+    }
+
+    SECTION("insert count and range") {
+        vec_t v{"a", "d"};
+        v.insert(v.begin() + 1, 2, "x");
+        REQUIRE(to_vector(v) == std::vector<std::string>{"a", "x", "x", "d"});
+
+        std::vector<std::string> const r{"b", "c"};
+        auto itr = v.insert(v.begin() + 1, r.begin(), r.end());
+        REQUIRE(itr == v.begin() + 1);
+        REQUIRE(to_vector(v) == std::vector<std::string>{"a", "b", "c", "x", "x", "d"});
+    }
+
+    SECTION("overflow") {
+        vec_t v(6, "z");
+        REQUIRE(v.full());
+        REQUIRE_THROWS_AS(v.push_back("a"), std::length_error);
+        REQUIRE_THROWS_AS(v.insert(v.begin(), 1, "a"), std::length_error);
+        REQUIRE_THROWS_AS(v.reserve(7), std::length_error);
+        REQUIRE(to_vector(v) == std::vector<std::string>(6, "z"));
+    }
+
+    SECTION("erase") {
+        vec_t v{"a", "b", "c", "d", "e"};
+        REQUIRE(*v.erase(v.begin() + 1) == "c");
+        REQUIRE(*v.erase(v.begin(), v.begin() + 2) == "d");
+        REQUIRE(to_vector(v) == std::vector<std::string>{"d", "e"});
+    }
+
+    SECTION("resize and assign") {
+        vec_t v;
+        v.resize(6, "z");
+        REQUIRE(v.size() == 6);
+        v.resize(1);
+        REQUIRE(to_vector(v) == std::vector<std::string>{"z"});
+        v.assign({"p", "q"});
+        REQUIRE(to_vector(v) == std::vector<std::string>{"p", "q"});
+        v.assign(5, "r");
+        REQUIRE(to_vector(v) == std::vector<std::string>(5, "r"));
+    }
+
+    SECTION("swap") {
+        vec_t small{"a"};
+        vec_t large{"b", "c", "d", "e", "f"};
+        small.swap(large);
+        REQUIRE(to_vector(small) == std::vector<std::string>{"b", "c", "d", "e", "f"});
+        REQUIRE(to_vector(large) == std::vector<std::string>{"a"});
+        swap(small, large);
+        REQUIRE(to_vector(small) == std::vector<std::string>{"a"});
+        REQUIRE(to_vector(large) == std::vector<std::string>{"b", "c", "d", "e", "f"});
+    }
+}
+
+TEST_CASE("static flat containers", "[static_flat_map]") {
+    SECTION("map") {
+        flat_map::static_flat_map<int, int, 4> fm;
+        for (int i = 4; i > 0; --i) {
+            REQUIRE(fm.emplace(i, i * 10).second);
+        }
+        REQUIRE(fm.full());
+
+        auto const [itr, inserted] = fm.emplace(5, 50);
+        REQUIRE_FALSE(inserted);
+        REQUIRE(itr == fm.end());
+        REQUIRE(fm.try_emplace(6, 60) == std::pair{fm.end(), false});
+        REQUIRE(fm.insert_or_assign(7, 70) == std::pair{fm.end(), false});
+        REQUIRE(fm.emplace_hint(fm.begin(), 0, 0) == fm.end());
+        REQUIRE(fm.try_emplace(fm.end(), 8, 80) == fm.end());
+        REQUIRE(fm.insert_or_assign(fm.end(), 9, 90) == fm.end());
+        REQUIRE(fm.size() == 4);
+
+        // Existing keys are found even if the map is full.
+        REQUIRE(fm.emplace(2, 0) == std::pair{std::next(fm.begin()), false});
+        REQUIRE(fm.insert_or_assign(3, 33).first->second == 33);
+        REQUIRE(fm[4] == 40);
+        int const key = 10;
+        REQUIRE_THROWS_AS(fm[key], std::length_error);
+        REQUIRE_THROWS_AS(fm[11], std::length_error);
+        REQUIRE(fm.size() == 4);
+
+        fm.erase(1);
+        REQUIRE_FALSE(fm.full());
+        REQUIRE(fm.emplace(5, 50).second);
+        REQUIRE(fm.at(5) == 50);
+    }
+
+    SECTION("node") {
+        using map_t     = flat_map::static_flat_map<int, int, 1>;
+        using node_type = map_t::node_type;
+
+        map_t fm{{1, 10}};
+        auto  result = fm.insert(node_type{{2, 20}});
+        REQUIRE_FALSE(result.inserted);
+        REQUIRE(result.position == fm.end());
+        REQUIRE(result.node.value == std::pair{2, 20});
+    }
+
+    SECTION("merge") {
+        flat_map::static_flat_map<int, int, 6> fm{{1, 10}, {2, 20}, {3, 30}};
+        flat_map::static_flat_map<int, int, 6> source{{3, 33}, {4, 40}, {5, 50}};
+        fm.merge(source);
+        REQUIRE(fm.size() == 5);
+        REQUIRE(fm.at(3) == 30);
+        REQUIRE(source.size() == 1);
+    }
+
+    SECTION("ranges which fit after deduplication") {
+        using map_t = flat_map::static_flat_map<int, int, 4>;
+
+        std::vector<std::pair<int, int>> const v{{3, 31}, {1, 11}, {3, 32}, {4, 41}, {1, 12},
+                                                 {2, 21}, {4, 42}, {2, 22}};
+        map_t fm(v.begin(), v.end());
+        REQUIRE(fm == map_t{{1, 11}, {2, 21}, {3, 31}, {4, 41}});
+
+        std::vector<std::pair<int, int>> sorted(v);
+        std::sort(sorted.begin(), sorted.end());
+        fm.insert(v.begin(), v.end());
+        fm.insert(flat_map::range_order::sorted, sorted.begin(), sorted.end());
+        fm.insert({{2, 0}, {2, 1}, {1, 0}});
+        REQUIRE(fm == map_t{{1, 11}, {2, 21}, {3, 31}, {4, 41}});
+
+        std::istringstream in{"5 1 4 2 3"};
+        flat_map::static_flat_set<int, 4> fs{1, 2, 3};
+        REQUIRE_THROWS_AS(
+            fs.insert(std::istream_iterator<int>{in}, std::istream_iterator<int>{}),
+            std::length_error
+        );
+        REQUIRE(fs.size() == 4);
+        REQUIRE(fs.contains(5));
+
+        map_t small{{1, 10}};
+        std::vector<std::pair<int, int>> const five{{1, 0}, {2, 0}, {3, 0}, {4, 0}, {5, 0}};
+        REQUIRE_THROWS_AS(
+            small.insert(flat_map::range_order::sorted, five.begin(), five.end()),
+            std::length_error
+        );
+        REQUIRE(small.size() == 1);
+        REQUIRE_THROWS_AS(map_t(five.begin(), five.end()), std::length_error);
+
+        flat_map::static_flat_multimap<int, int, 4> fmm{{1, 10}, {2, 20}, {3, 30}};
+        REQUIRE_THROWS_AS(fmm.insert(v.begin(), v.begin() + 2), std::length_error);
+    }
+
+    SECTION("multimap") {
+        flat_map::static_flat_multimap<int, int, 2> fm;
+        REQUIRE(fm.emplace(1, 10)->second == 10);
+        REQUIRE(fm.emplace(1, 11)->second == 11);
+        REQUIRE(fm.emplace(1, 12) == fm.end());
+        REQUIRE(fm.emplace_hint(fm.begin(), 0, 0) == fm.end());
+        REQUIRE(fm.count(1) == 2);
+    }
+
+    SECTION("set") {
+        flat_map::static_flat_set<int, 2> fs{3, 1};
+        REQUIRE(fs.insert(2) == std::pair{fs.end(), false});
+        REQUIRE(fs.insert(3) == std::pair{std::next(fs.begin()), false});
+
+        flat_map::static_flat_multiset<int, 2> fms{1, 1};
+        REQUIRE(fms.insert(1) == fms.end());
+    }
+}
+
+TEST_CASE("static flat containers without allocation", "[static_flat_map]") {
+    // Long enough for radix sort, which allocates buffers, if the container isn't bounded.
+    std::vector<std::pair<int, int>> v;
+    for (int i = 0; i < 1500; ++i) {
+        v.emplace_back(i * 7919 % 1500, i);
+    }
+    std::vector<std::pair<int, int>> sorted(v.begin(), v.begin() + 400);
+    std::sort(sorted.begin(), sorted.end());
+    std::istringstream is{"5 1 4 2 3"};
+    std::vector<int>   keys{std::istream_iterator<int>{is}, {}};
+
+    auto const before = allocations;
+    {
+        flat_map::static_flat_map<int, int, 2048> fm(v.begin(), v.end());
+        fm.insert(v.rbegin(), v.rend());
+
+        flat_map::static_flat_multimap<int, int, 2048> fmm(v.begin(), v.end());
+        fmm.insert(flat_map::range_order::sorted, sorted.begin(), sorted.end());
+
+        flat_map::static_flat_multimap<int, int, 2048, std::greater<int>> source(
+            v.begin(), v.begin() + 100
+        );
+        fmm.merge(source);
+
+        flat_map::static_flat_set<int, 8> fs(keys.begin(), keys.end());
+        fs.insert(keys.begin(), keys.end());
+    }
+    auto const count = allocations - before;
+    REQUIRE(count == 0);
+}
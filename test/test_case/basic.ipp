@@ -1,12 +1,16 @@
 // Copyright (c) 2021,2023 Kohei Takahashi
 // This software is released under the MIT License, see LICENSE.
 
+#include <algorithm>
 #include <catch2/catch_test_macros.hpp>
 #include <functional>
 #include <iterator>
+#include <stdexcept>
+#include <type_traits>
 #include <vector>
 
 #include "config.hpp"
+#include "iterator.hpp"
 
 template <typename T>
 struct wrap {
@@ -23,6 +27,16 @@ bool operator<(wrap<T> lhs, T rhs) {
     return lhs.value < rhs;
 }
 
+// Throws on negative keys.
+struct throwing_less {
+    bool operator()(int lhs, int rhs) const {
+        if (lhs < 0 || rhs < 0) {
+            throw std::domain_error("negative key");
+        }
+        return lhs < rhs;
+    }
+};
+
 TEST_CASE("construction", "[construction]") {
     SECTION("default construction") { FLAT_CONTAINER<int, int> fm; }
 
@@ -177,7 +191,7 @@ TEST_CASE("construction", "[construction]") {
 
         auto move = std::move(fm);
 
-        REQUIRE(ptr == to_pointer_tuple(*move.begin()));
+        REQUIRE_MOVED_ADDRESS(ptr, move);
         REQUIRE(move.begin() != fm.begin());
         REQUIRE(fm.begin() == fm.end());
 
@@ -190,6 +204,58 @@ TEST_CASE("construction", "[construction]") {
     }
 }
 
+// Fixed capacity containers can't hold as many elements as this test uses.
+#if !FIXED_CAPACITY
+TEST_CASE("parallel construction", "[construction]") {
+    std::vector<decltype(MAKE_PAIR(0, 0))> v;
+    for (int i = 0; i < 100000; ++i) {
+        v.push_back(MAKE_PAIR(i * 7919 % 5003, i));
+    }
+    FLAT_CONTAINER<int, int> const expected{v.begin(), v.end()};
+    flat_map::parallel_policy const policy{4};
+
+    SECTION("iter construction") {
+        FLAT_CONTAINER<int, int> fm{policy, v.begin(), v.end()};
+        REQUIRE(fm == expected);
+    }
+
+    SECTION("pre constructed container") {
+        using container_type = std::decay_t<decltype(expected.get_container())>;
+        FLAT_CONTAINER<int, int> fm{
+            policy, flat_map::range_order::no_ordered, container_type(v.begin(), v.end())
+        };
+        REQUIRE(fm == expected);
+    }
+
+    SECTION("insert range") {
+        auto const mid = std::next(v.begin(), v.size() / 3);
+
+        FLAT_CONTAINER<int, int> fm{v.begin(), mid};
+        fm.insert(policy, flat_map::range_order::no_ordered, mid, v.end());
+        REQUIRE(fm == expected);
+    }
+
+    SECTION("throwing comparator") {
+        using container_type = FLAT_CONTAINER<int, int, throwing_less>;
+
+        // On a spawned thread.
+        v.front() = MAKE_PAIR(-1, 0);
+        REQUIRE_THROWS_AS((container_type{policy, v.begin(), v.end()}), std::domain_error);
+
+        // On the calling thread.
+        v.front() = MAKE_PAIR(0, 0);
+        v.back()  = MAKE_PAIR(-1, 0);
+        REQUIRE_THROWS_AS((container_type{policy, v.begin(), v.end()}), std::domain_error);
+
+        container_type fm;
+        REQUIRE_THROWS_AS(
+            fm.insert(policy, flat_map::range_order::no_ordered, v.begin(), v.end()),
+            std::domain_error
+        );
+    }
+}
+#endif
+
 TEST_CASE("assignment", "[assignment]") {
     SECTION("copy assignment") {
         FLAT_CONTAINER<int, int> fm = {
@@ -231,7 +297,7 @@ TEST_CASE("assignment", "[assignment]") {
         };
         move = std::move(fm);
 
-        REQUIRE(ptr == to_pointer_tuple(*move.begin()));
+        REQUIRE_MOVED_ADDRESS(ptr, move);
         REQUIRE(move.begin() != fm.begin());
         REQUIRE(fm.begin() == fm.end());
 
@@ -269,6 +335,45 @@ TEST_CASE("size", "[size]") {
         fm.clear();
         REQUIRE(fm.empty());
     }
+
+    SECTION("capacity") {
+        FLAT_CONTAINER<int, int> fm;
+
+        [](auto& fm) {
+            using flat_type      = std::decay_t<decltype(fm)>;
+            using container_type = std::decay_t<decltype(fm.get_container())>;
+
+            static_assert(
+                flat_map::concepts::Reservable<flat_type>
+                == flat_map::concepts::Reservable<container_type>
+            );
+            static_assert(
+                flat_map::concepts::HasCapacity<flat_type>
+                == flat_map::concepts::HasCapacity<container_type>
+            );
+            static_assert(
+                flat_map::concepts::Shrinkable<flat_type>
+                == flat_map::concepts::Shrinkable<container_type>
+            );
+
+            if constexpr (flat_map::concepts::Reservable<container_type>) {
+                fm.reserve(100);
+                REQUIRE(fm.capacity() >= 100);
+
+                auto const capacity = fm.capacity();
+                for (int i = 0; i < 100; ++i) {
+                    fm.insert(MAKE_PAIR(i, i));
+                }
+                REQUIRE(fm.capacity() == capacity);
+
+                fm.erase(fm.begin(), std::next(fm.begin(), 90));
+                fm.shrink_to_fit();
+                REQUIRE(fm.size() == 10);
+                REQUIRE(fm.capacity() >= 10);
+                REQUIRE(FIRST(*fm.begin()) == 90);
+            }
+        }(fm);
+    }
 }
 
 TEST_CASE("equal_range", "[equal_range]") {
@@ -511,6 +616,90 @@ TEST_CASE("accessor with transparent", "[accessor]") {
     }
 }
 
+TEST_CASE("batched accessor", "[accessor]") {
+    FLAT_CONTAINER<int, int> fm;
+    for (int i = 0; i < 100; ++i) {
+        fm.insert(MAKE_PAIR(i * 2, i));
+#if MULTI_CONTAINER
+        fm.insert(MAKE_PAIR(i * 2, i + 100));
+#endif
+    }
+    auto const& cfm = fm;
+
+    std::vector<int> keys;
+    for (int i = 0; i < 50; ++i) {
+        keys.push_back((i * 37) % 203 - 1);
+    }
+    std::vector<int> sorted_keys = keys;
+    std::sort(sorted_keys.begin(), sorted_keys.end());
+
+    SECTION("find_many") {
+        std::vector<decltype(fm.begin())> result;
+        fm.find_many(keys.begin(), keys.end(), std::back_inserter(result));
+        REQUIRE(result.size() == keys.size());
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            REQUIRE(result[i] == fm.find(keys[i]));
+        }
+
+        std::vector<decltype(cfm.begin())> cresult;
+        cfm.find_many(
+            flat_map::range_order::sorted,
+            sorted_keys.begin(),
+            sorted_keys.end(),
+            std::back_inserter(cresult)
+        );
+        REQUIRE(cresult.size() == sorted_keys.size());
+        for (std::size_t i = 0; i < sorted_keys.size(); ++i) {
+            REQUIRE(cresult[i] == cfm.find(sorted_keys[i]));
+        }
+    }
+
+    SECTION("contains_many") {
+        std::vector<bool> result;
+        cfm.contains_many(keys.begin(), keys.end(), std::back_inserter(result));
+        cfm.contains_many(
+            flat_map::range_order::sorted,
+            sorted_keys.begin(),
+            sorted_keys.end(),
+            std::back_inserter(result)
+        );
+        REQUIRE(result.size() == keys.size() * 2);
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            REQUIRE(result[i] == cfm.contains(keys[i]));
+            REQUIRE(result[keys.size() + i] == cfm.contains(sorted_keys[i]));
+        }
+    }
+
+    SECTION("lower_bound_many") {
+        std::vector<decltype(fm.begin())> result;
+        fm.lower_bound_many(keys.begin(), keys.end(), std::back_inserter(result));
+        fm.lower_bound_many(
+            flat_map::range_order::sorted,
+            sorted_keys.begin(),
+            sorted_keys.end(),
+            std::back_inserter(result)
+        );
+        REQUIRE(result.size() == keys.size() * 2);
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            REQUIRE(result[i] == fm.lower_bound(keys[i]));
+            REQUIRE(result[keys.size() + i] == fm.lower_bound(sorted_keys[i]));
+        }
+    }
+
+    SECTION("empty") {
+        FLAT_CONTAINER<int, int> empty;
+        std::vector<bool>        result;
+        empty.contains_many(keys.begin(), keys.end(), std::back_inserter(result));
+        empty.contains_many(
+            flat_map::range_order::sorted,
+            sorted_keys.begin(),
+            sorted_keys.end(),
+            std::back_inserter(result)
+        );
+        REQUIRE(result == std::vector<bool>(keys.size() * 2, false));
+    }
+}
+
 TEST_CASE("insertion", "[insertion]") {
     SECTION("insert") {
         FLAT_CONTAINER<int, int> fm = {
@@ -832,6 +1021,108 @@ TEST_CASE("insertion", "[insertion]") {
 #endif
         REQUIRE(itr == fm.end());
     }
+
+    SECTION("insert sorted range at both ends") {
+        std::vector v = {
+            MAKE_PAIR(0, 1),
+            MAKE_PAIR(0, 2),
+            MAKE_PAIR(4, 9),
+            MAKE_PAIR(8, 1),
+            MAKE_PAIR(8, 2),
+        };
+        FLAT_CONTAINER<int, int> fm = {
+            MAKE_PAIR(4, 5),
+            MAKE_PAIR(6, 7),
+        };
+
+        fm.insert(flat_map::range_order::sorted, v.begin(), v.end());
+
+        auto itr = fm.begin();
+        REQUIRE(*itr++ == MAKE_PAIR(0, 1));
+#if MULTI_CONTAINER
+        REQUIRE(*itr++ == MAKE_PAIR(0, 2));
+#endif
+        REQUIRE(*itr++ == MAKE_PAIR(4, 5));
+#if MULTI_CONTAINER
+        REQUIRE(*itr++ == MAKE_PAIR(4, 9));
+#endif
+        REQUIRE(*itr++ == MAKE_PAIR(6, 7));
+        REQUIRE(*itr++ == MAKE_PAIR(8, 1));
+#if MULTI_CONTAINER
+        REQUIRE(*itr++ == MAKE_PAIR(8, 2));
+#endif
+        REQUIRE(itr == fm.end());
+
+        FLAT_CONTAINER<int, int> empty;
+        empty.insert(flat_map::range_order::sorted, v.begin(), v.end());
+#if MULTI_CONTAINER
+        REQUIRE(empty.size() == 5);
+#else
+        REQUIRE(empty.size() == 3);
+#endif
+        REQUIRE(*empty.begin() == MAKE_PAIR(0, 1));
+    }
+
+    SECTION("insert single-pass range") {
+        std::vector v = {
+            MAKE_PAIR(1, 3),
+            MAKE_PAIR(1, 2),
+            MAKE_PAIR(3, 9),
+            MAKE_PAIR(6, 4),
+            MAKE_PAIR(7, 8),
+            MAKE_PAIR(7, 9),
+        };
+        FLAT_CONTAINER<int, int> const expected = {
+            MAKE_PAIR(0, 1),
+            MAKE_PAIR(1, 3),
+#if MULTI_CONTAINER
+            MAKE_PAIR(1, 2),
+#endif
+            MAKE_PAIR(2, 3),
+            MAKE_PAIR(3, 9),
+            MAKE_PAIR(4, 5),
+            MAKE_PAIR(6, 7),
+#if MULTI_CONTAINER
+            MAKE_PAIR(6, 4),
+#endif
+            MAKE_PAIR(7, 8),
+#if MULTI_CONTAINER
+            MAKE_PAIR(7, 9),
+#endif
+        };
+
+        using flat_map::range_order;
+        for (auto const order : {range_order::no_ordered, range_order::sorted}) {
+            FLAT_CONTAINER<int, int> fm = {
+                MAKE_PAIR(0, 1),
+                MAKE_PAIR(2, 3),
+                MAKE_PAIR(4, 5),
+                MAKE_PAIR(6, 7),
+            };
+            fm.insert(order, single_pass_iterator{v.begin()}, single_pass_iterator{v.end()});
+            REQUIRE(fm == expected);
+        }
+    }
+
+    SECTION("sorted range with throwing comparator") {
+        std::vector v = {MAKE_PAIR(-1, 0)};
+        for (int i = 0; i < 10; ++i) {
+            v.push_back(MAKE_PAIR(i * 2 + 1, i));
+        }
+        FLAT_CONTAINER<int, int, throwing_less> fm;
+        for (int i = 0; i < 10; ++i) {
+            fm.insert(MAKE_PAIR(i * 2, i));
+        }
+
+        // Elements merged before the exception are kept, without any gap.
+        REQUIRE_THROWS_AS(
+            fm.insert(flat_map::range_order::sorted, v.begin(), v.end()), std::domain_error
+        );
+        REQUIRE(std::is_sorted(fm.begin(), fm.end()));
+        for (int i = 0; i < 10; ++i) {
+            REQUIRE(fm.count(i * 2) == 1);
+        }
+    }
 }
 
 TEST_CASE("erase", "[erase]") {
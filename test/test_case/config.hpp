@@ -82,6 +82,13 @@ using STD_MULTI_CONTAINER = std::multiset<Key, Compare>;
 
 #endif
 
+// Moving a container with inline storage relocates its elements.
+#if INLINE_STORAGE
+#    define REQUIRE_MOVED_ADDRESS(ptr, c) static_cast<void>(ptr)
+#else
+#    define REQUIRE_MOVED_ADDRESS(ptr, c) REQUIRE(ptr == to_pointer_tuple(*c.begin()))
+#endif
+
 #if MULTI_CONTAINER
 #    define FLAT_CONTAINER_KEY FLAT_MULTI_CONTAINER_KEY
 #else
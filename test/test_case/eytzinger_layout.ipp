@@ -0,0 +1,79 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <iterator>
+
+#include "config.hpp"
+#include "flat_map/eytzinger_layout.hpp"
+
+TEST_CASE("eytzinger layout", "[eytzinger_layout]") {
+    FLAT_CONTAINER<int, int> fm;
+    for (int i = 0; i < 100; ++i) {
+        fm.insert(MAKE_PAIR(i * 2, i));
+#if MULTI_CONTAINER
+        fm.insert(MAKE_PAIR(i * 2, i + 100));
+#endif
+    }
+    auto const orig = fm;
+
+    flat_map::eytzinger_layout layout{std::move(fm)};
+    REQUIRE(layout.size() == orig.size());
+
+    SECTION("find") {
+        for (int i = -1; i < 201; ++i) {
+            auto itr = layout.find(i);
+            if (i >= 0 && i < 200 && i % 2 == 0) {
+                REQUIRE(itr != layout.end());
+                REQUIRE(*itr == *orig.find(i));
+                REQUIRE(layout.contains(i));
+            } else {
+                REQUIRE(itr == layout.end());
+                REQUIRE_FALSE(layout.contains(i));
+            }
+        }
+    }
+
+    SECTION("lower_bound") {
+        for (int i = -1; i < 201; ++i) {
+            auto itr = layout.lower_bound(i);
+            if (orig.lower_bound(i) == orig.end()) {
+                REQUIRE(itr == layout.end());
+            } else {
+                REQUIRE(*itr == *orig.lower_bound(i));
+            }
+        }
+    }
+
+    SECTION("upper_bound") {
+        for (int i = -1; i < 201; ++i) {
+            auto itr = layout.upper_bound(i);
+            if (orig.upper_bound(i) == orig.end()) {
+                REQUIRE(itr == layout.end());
+            } else {
+                REQUIRE(*itr == *orig.upper_bound(i));
+            }
+        }
+    }
+
+    SECTION("restore") {
+        auto restored = std::move(layout).extract();
+        REQUIRE(restored == orig);
+        REQUIRE(layout.empty());
+    }
+}
+
+TEST_CASE("eytzinger layout of small container", "[eytzinger_layout]") {
+    for (int n = 0; n < 17; ++n) {
+        FLAT_CONTAINER<int, int> fm;
+        for (int i = 0; i < n; ++i) {
+            fm.insert(MAKE_PAIR(i, i));
+        }
+
+        flat_map::eytzinger_layout const layout{fm};
+        for (int i = -1; i <= n; ++i) {
+            REQUIRE(layout.contains(i) == fm.contains(i));
+        }
+        REQUIRE(std::move(flat_map::eytzinger_layout{layout}).extract() == fm);
+    }
+}
@@ -0,0 +1,34 @@
+// Copyright (c) 2026 Kohei Takahashi
+// This software is released under the MIT License, see LICENSE.
+
+#pragma once
+
+#include <iterator>
+
+// Single-pass view of a forward iterator.
+template <typename Iterator>
+class single_pass_iterator {
+    Iterator _it;
+
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = typename std::iterator_traits<Iterator>::value_type;
+    using difference_type   = typename std::iterator_traits<Iterator>::difference_type;
+    using pointer           = typename std::iterator_traits<Iterator>::pointer;
+    using reference         = typename std::iterator_traits<Iterator>::reference;
+
+    explicit single_pass_iterator(Iterator it) : _it{it} {}
+
+    reference operator*() const { return *_it; }
+
+    single_pass_iterator& operator++() {
+        ++_it;
+        return *this;
+    }
+
+    bool operator==(single_pass_iterator const& other) const { return _it == other._it; }
+    bool operator!=(single_pass_iterator const& other) const { return _it != other._it; }
+};
+
+template <typename Iterator>
+single_pass_iterator(Iterator) -> single_pass_iterator<Iterator>;
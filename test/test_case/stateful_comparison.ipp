@@ -90,7 +90,7 @@ TEST_CASE("construction fp", "[construction][fp]") {
 
         auto move = std::move(fm);
 
-        REQUIRE(ptr == to_pointer_tuple(*move.begin()));
+        REQUIRE_MOVED_ADDRESS(ptr, move);
         REQUIRE(move.begin() != fm.begin());
         REQUIRE(fm.begin() == fm.end());
 
@@ -162,7 +162,7 @@ TEST_CASE("assignment fp", "[assignment][fp]") {
         };
         move = std::move(fm);
 
-        REQUIRE(ptr == to_pointer_tuple(*move.begin()));
+        REQUIRE_MOVED_ADDRESS(ptr, move);
         REQUIRE(move.begin() != fm.begin());
         REQUIRE(fm.begin() == fm.end());
 
@@ -297,7 +297,7 @@ TEST_CASE("construction functor", "[construction][functor]") {
 
         auto move = std::move(fm);
 
-        REQUIRE(ptr == to_pointer_tuple(*move.begin()));
+        REQUIRE_MOVED_ADDRESS(ptr, move);
         REQUIRE(move.begin() != fm.begin());
         REQUIRE(fm.begin() == fm.end());
 
@@ -369,7 +369,7 @@ TEST_CASE("assignment functor", "[assignment][functor]") {
         };
         move = std::move(fm);
 
-        REQUIRE(ptr == to_pointer_tuple(*move.begin()));
+        REQUIRE_MOVED_ADDRESS(ptr, move);
         REQUIRE(move.begin() != fm.begin());
         REQUIRE(fm.begin() == fm.end());
 
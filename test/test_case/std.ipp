@@ -1,7 +1,11 @@
 // Copyright (c) 2021,2023 Kohei Takahashi
 // This software is released under the MIT License, see LICENSE.
 
+#include <algorithm>
 #include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 #include "config.hpp"
 
@@ -405,4 +409,226 @@ TEST_CASE("merge", "[merge]") {
         );
 #endif
     }
+
+    SECTION("from interleaved flat multi container with same order") {
+        FLAT_CONTAINER<int, int>       fm;
+        FLAT_MULTI_CONTAINER<int, int> m;
+        for (int i = 0; i < 100; i += 2) {
+            fm.insert(MAKE_PAIR(i, i));
+        }
+        for (int i = 0; i < 150; i += 3) {
+            m.insert(MAKE_PAIR(i, i));
+            m.insert(MAKE_PAIR(i, -i));
+        }
+
+        fm.merge(m);
+
+#if MULTI_CONTAINER
+        REQUIRE(fm.size() == 150);
+        REQUIRE(m.empty());
+#else
+        REQUIRE(fm.size() == 83);
+        REQUIRE(m.size() == 67);
+        REQUIRE(std::is_sorted(m.begin(), m.end(), m.value_comp()));
+        for (auto const& e : m) {
+            REQUIRE(fm.contains(FIRST(e)));
+        }
+#endif
+        REQUIRE(std::is_sorted(fm.begin(), fm.end(), fm.value_comp()));
+        for (int i = 0; i < 150; ++i) {
+            REQUIRE(fm.contains(i) == ((i % 2 == 0 && i < 100) || i % 3 == 0));
+        }
+#if FLAT_MAP && !MULTI_CONTAINER
+        REQUIRE(std::get<1>(*fm.find(3)) == 3);
+        REQUIRE(std::get<1>(*fm.find(6)) == 6);
+#endif
+    }
+}
+
+// Throws when budget runs out, which is shared between all instances so that it's stateless.
+struct countdown_less {
+    static inline int budget = -1;
+
+    bool operator()(int lhs, int rhs) const {
+        if (--budget == 0) {
+            throw std::runtime_error("out of budget");
+        }
+        return lhs < rhs;
+    }
+};
+
+TEST_CASE("merge_all", "[merge]") {
+    FLAT_CONTAINER<int, int> fm = {MAKE_PAIR(0, 0), MAKE_PAIR(5, 50)};
+
+    FLAT_CONTAINER<int, int> ans = {
+        MAKE_PAIR(0, 0),
+#if MULTI_CONTAINER
+        MAKE_PAIR(0, 2),
+#endif
+        MAKE_PAIR(1, 10),
+#if MULTI_CONTAINER
+        MAKE_PAIR(1, 11),
+#endif
+        MAKE_PAIR(2, 21),
+        MAKE_PAIR(4, 40),
+        MAKE_PAIR(5, 50),
+        MAKE_PAIR(7, 70),
+#if MULTI_CONTAINER
+        MAKE_PAIR(7, 71),
+        MAKE_PAIR(7, 72),
+#endif
+        MAKE_PAIR(9, 92),
+    };
+
+    auto const check = [&](auto const& sources) {
+        REQUIRE(fm == ans);
+        REQUIRE(sources[0].empty());
+#if MULTI_CONTAINER
+        REQUIRE(sources[1].empty());
+        REQUIRE(sources[2].empty());
+#else
+        REQUIRE(sources[1].size() == 3);
+        REQUIRE(sources[1].count(1) == 1);
+        REQUIRE(sources[1].count(7) == 2);
+        REQUIRE(sources[2].size() == 1);
+        REQUIRE(sources[2].count(0) == 1);
+#endif
+    };
+
+    SECTION("from flat multi containers with same order") {
+        std::vector<FLAT_MULTI_CONTAINER<int, int>> sources = {
+            {MAKE_PAIR(1, 10), MAKE_PAIR(4, 40), MAKE_PAIR(7, 70)},
+            {MAKE_PAIR(1, 11), MAKE_PAIR(2, 21), MAKE_PAIR(7, 71), MAKE_PAIR(7, 72)},
+            {MAKE_PAIR(0, 2), MAKE_PAIR(9, 92)},
+        };
+
+        fm.merge_all(sources);
+        check(sources);
+    }
+
+    SECTION("from std multi containers with same order") {
+        std::vector<STD_MULTI_CONTAINER<int, int>> sources = {
+            {MAKE_STD_PAIR(1, 10), MAKE_STD_PAIR(4, 40), MAKE_STD_PAIR(7, 70)},
+            {MAKE_STD_PAIR(1, 11),
+             MAKE_STD_PAIR(2, 21),
+             MAKE_STD_PAIR(7, 71),
+             MAKE_STD_PAIR(7, 72)},
+            {MAKE_STD_PAIR(0, 2), MAKE_STD_PAIR(9, 92)},
+        };
+
+        fm.merge_all(sources);
+        check(sources);
+    }
+
+    SECTION("from flat multi containers with reversed order") {
+        std::vector<FLAT_MULTI_CONTAINER<int, int, std::greater<int>>> sources = {
+            {MAKE_PAIR(1, 10), MAKE_PAIR(4, 40), MAKE_PAIR(7, 70)},
+            {MAKE_PAIR(1, 11), MAKE_PAIR(2, 21), MAKE_PAIR(7, 71), MAKE_PAIR(7, 72)},
+            {MAKE_PAIR(0, 2), MAKE_PAIR(9, 92)},
+        };
+
+        fm.merge_all(sources);
+        check(sources);
+    }
+
+    SECTION("same as merge one by one") {
+        std::vector<FLAT_MULTI_CONTAINER<int, int>> sources(7);
+        for (int i = 0; i < 7; ++i) {
+            for (int j = 0; j < 50; ++j) {
+                sources[i].insert(MAKE_PAIR((j * 7 + i * 13) % 61, i * 100 + j));
+            }
+        }
+        auto expected_sources = sources;
+        auto expected         = fm;
+        for (auto& source : expected_sources) {
+            expected.merge(source);
+        }
+
+        fm.merge_all(sources);
+        REQUIRE(fm == expected);
+        REQUIRE(sources == expected_sources);
+    }
+
+    // Just below and at the number of sources from which they are merged by a k-way merge.
+    SECTION("many sources") {
+        using value_type         = FLAT_CONTAINER<int, int>::value_type;
+        constexpr auto threshold =
+            flat_map::detail::k_way_merge_threshold_v<value_type, !MULTI_CONTAINER>;
+
+        for (int const n : {int(threshold) - 1, int(threshold)}) {
+            auto                                        dst = fm;
+            std::vector<FLAT_MULTI_CONTAINER<int, int>> sources(n);
+            std::vector<STD_MULTI_CONTAINER<int, int>>  std_sources(n);
+            for (int i = 0; i < n; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    sources[i].insert(MAKE_PAIR((j * 37 + i * 13) % 211, i * 100 + j));
+                    std_sources[i].insert(MAKE_STD_PAIR((j * 37 + i * 13) % 211, i * 100 + j));
+                }
+            }
+            auto expected_sources = sources;
+            auto expected         = dst;
+            for (auto& source : expected_sources) {
+                expected.merge(source);
+            }
+
+            auto std_dst = dst;
+            dst.merge_all(sources);
+            REQUIRE(dst == expected);
+            REQUIRE(sources == expected_sources);
+
+            std_dst.merge_all(std_sources);
+            REQUIRE(std_dst == expected);
+            for (std::size_t i = 0; i < sources.size(); ++i) {
+                REQUIRE(std_sources[i].size() == sources[i].size());
+            }
+        }
+    }
+
+#if !FIXED_CAPACITY
+    SECTION("many sources with throwing comparator") {
+        countdown_less::budget = -1;
+        FLAT_CONTAINER<int, std::string, countdown_less> dst{
+            MAKE_PAIR(0, std::string("0")), MAKE_PAIR(105, std::string("50"))
+        };
+        std::vector<FLAT_MULTI_CONTAINER<int, std::string, countdown_less>> sources(150);
+        for (int i = 0; i < 150; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                sources[i].insert(
+                    MAKE_PAIR((j * 37 + i * 13) % 211, std::to_string(i * 100 + j))
+                );
+            }
+        }
+
+        countdown_less::budget = 2000;
+        REQUIRE_THROWS_AS(dst.merge_all(sources), std::runtime_error);
+        countdown_less::budget = -1;
+
+        // Every element is either merged or left in its source, but not moved from.
+        [[maybe_unused]] auto const moved_from = [](auto const& e) {
+            return std::get<1>(e).empty();
+        };
+        auto total = dst.size();
+        REQUIRE(std::is_sorted(dst.begin(), dst.end(), dst.value_comp()));
+#    if FLAT_MAP
+        REQUIRE(std::none_of(dst.begin(), dst.end(), moved_from));
+#    endif
+        for (auto& source : sources) {
+            REQUIRE(std::is_sorted(source.begin(), source.end(), source.value_comp()));
+#    if FLAT_MAP
+            REQUIRE(std::none_of(source.begin(), source.end(), moved_from));
+#    endif
+            total += source.size();
+        }
+        REQUIRE(total == 452);
+    }
+#endif
+
+    SECTION("from empty sources") {
+        std::vector<FLAT_UNIQ_CONTAINER<int, int>> sources(2);
+
+        fm.merge_all(sources);
+        REQUIRE(fm == FLAT_CONTAINER<int, int>{MAKE_PAIR(0, 0), MAKE_PAIR(5, 50)});
+        fm.merge_all(std::vector<FLAT_UNIQ_CONTAINER<int, int>>{});
+        REQUIRE(fm.size() == 2);
+    }
 }
@@ -1,8 +1,10 @@
 // Copyright (c) 2021,2023 Kohei Takahashi
 // This software is released under the MIT License, see LICENSE.
 
+#include <algorithm>
 #include <catch2/catch_test_macros.hpp>
 #include <deque>
+#include <iterator>
 #include <map>
 #include <stdexcept>
 #include <tuple>
@@ -11,6 +13,7 @@
 
 #include "flat_map/tied_sequence.hpp"
 #include "test_case/catch2_tuple.hpp"
+#include "test_case/iterator.hpp"
 #include "test_case/memory.hpp"
 
 TEST_CASE("zip_iterator", "[iterator]") {
@@ -355,6 +358,24 @@ TEST_CASE("construction", "[construction]") {
         REQUIRE(ts[3] == std::tuple{6, 7});
     }
 
+    SECTION("from input iterator") {
+        std::vector v = {
+            std::tuple{0, 1},
+            std::tuple{2, 3},
+            std::tuple{4, 5},
+            std::tuple{6, 7},
+        };
+
+        flat_map::tied_sequence<std::vector<int>, std::deque<int>> ts(
+            single_pass_iterator{v.begin()}, single_pass_iterator{v.end()}
+        );
+        REQUIRE(ts.size() == 4);
+        REQUIRE(ts[0] == std::tuple{0, 1});
+        REQUIRE(ts[1] == std::tuple{2, 3});
+        REQUIRE(ts[2] == std::tuple{4, 5});
+        REQUIRE(ts[3] == std::tuple{6, 7});
+    }
+
     SECTION("copy ctor") {
         flat_map::tied_sequence<std::vector<int>, std::vector<int>> src(4, {1, 2});
         auto                                                        dst = src;
@@ -487,6 +508,25 @@ TEST_CASE("assignment", "[assignment]") {
         REQUIRE(ts[3] == std::tuple{6, 7});
     }
 
+    SECTION("from input iterator") {
+        std::vector v = {
+            std::tuple{0, 1},
+            std::tuple{2, 3},
+            std::tuple{4, 5},
+        };
+
+        flat_map::tied_sequence<std::vector<int>, std::vector<int>> ts = {
+            {8, 9},
+            {6, 7},
+        };
+        ts.assign(single_pass_iterator{v.begin()}, single_pass_iterator{v.end()});
+
+        REQUIRE(ts.size() == 3);
+        REQUIRE(ts[0] == std::tuple{0, 1});
+        REQUIRE(ts[1] == std::tuple{2, 3});
+        REQUIRE(ts[2] == std::tuple{4, 5});
+    }
+
     SECTION("assign initializer_list") {
         flat_map::tied_sequence<std::vector<int>, std::vector<int>> ts;
         ts.assign({
@@ -603,6 +643,37 @@ TEST_CASE("capacity", "[capacity]") {
         ts.clear();
         REQUIRE(ts.size() == 0);
     }
+
+    SECTION("reserve") {
+        flat_map::tied_sequence<std::vector<int>, std::vector<char>> ts = {
+            {0, 'a'},
+            {1, 'b'},
+        };
+
+        ts.reserve(100);
+        REQUIRE(ts.capacity() >= 100);
+        REQUIRE(flat_map::get_sequence<0>(ts).capacity() >= 100);
+        REQUIRE(flat_map::get_sequence<1>(ts).capacity() >= 100);
+        REQUIRE(ts.size() == 2);
+
+        REQUIRE(
+            ts.capacity()
+            == std::min(
+                flat_map::get_sequence<0>(ts).capacity(), flat_map::get_sequence<1>(ts).capacity()
+            )
+        );
+
+        ts.shrink_to_fit();
+        REQUIRE(ts.capacity() >= 2);
+        REQUIRE(ts[1] == std::tuple{1, 'b'});
+    }
+
+    SECTION("with deque") {
+        using ts = flat_map::tied_sequence<std::vector<int>, std::deque<int>>;
+        static_assert(!flat_map::concepts::Reservable<ts>);
+        static_assert(!flat_map::concepts::HasCapacity<ts>);
+        static_assert(flat_map::concepts::Shrinkable<ts>);
+    }
 }
 
 TEST_CASE("insertion", "[insertion]") {
@@ -671,6 +742,28 @@ TEST_CASE("insertion", "[insertion]") {
         REQUIRE(ts[3] == std::tuple{6, 7});
     }
 
+    SECTION("from input iterator") {
+        std::vector v = {
+            std::tuple{2, 3},
+            std::tuple{4, 5},
+        };
+
+        flat_map::tied_sequence<std::vector<int>, std::deque<int>> ts = {
+            {0, 1},
+            {6, 7},
+        };
+        auto itr = ts.insert(
+            std::next(ts.begin()), single_pass_iterator{v.begin()}, single_pass_iterator{v.end()}
+        );
+        REQUIRE(itr == std::next(ts.begin()));
+
+        REQUIRE(ts.size() == 4);
+        REQUIRE(ts[0] == std::tuple{0, 1});
+        REQUIRE(ts[1] == std::tuple{2, 3});
+        REQUIRE(ts[2] == std::tuple{4, 5});
+        REQUIRE(ts[3] == std::tuple{6, 7});
+    }
+
     SECTION("initializer_list") {
         flat_map::tied_sequence<std::vector<int>, std::vector<int>> ts = {
             {0, 1},
@@ -786,6 +879,26 @@ TEST_CASE("tail erasure", "[erase]") {
         REQUIRE(ts[1] == std::tuple{2, 3});
         REQUIRE(ts[2] == std::tuple{4, 5});
     }
+
+    SECTION("resize") {
+        flat_map::tied_sequence<std::vector<int>, std::vector<int>> ts = {
+            {0, 1},
+            {2, 3},
+        };
+
+        ts.resize(3);
+        REQUIRE(ts.size() == 3);
+        REQUIRE(ts[2] == std::tuple{0, 0});
+
+        ts.resize(5, {8, 9});
+        REQUIRE(ts.size() == 5);
+        REQUIRE(ts[1] == std::tuple{2, 3});
+        REQUIRE(ts[4] == std::tuple{8, 9});
+
+        ts.resize(1);
+        REQUIRE(ts.size() == 1);
+        REQUIRE(ts[0] == std::tuple{0, 1});
+    }
 }
 
 TEST_CASE("swap", "[swap]") {